@@ -0,0 +1,156 @@
+"""
+Accès direct (ctypes) à la bibliothèque C libtsp.so : l'instance est chargée
+une seule fois et les méthodes sont appelées sans lancer de processus.
+Construire la bibliothèque avec 'make' dans code/.
+"""
+import ctypes
+import os
+
+_chemin_defaut = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "code", "libtsp.so")
+
+# Options de la ligne de commande -> noms de tsp_options_definir
+_OPTIONS = {"-r": "runs", "-j": "threads", "-k": "perturbations", "-t": "duree"}
+
+
+class ErreurTSP(Exception):
+    pass
+
+
+def _declarer(lib):
+    p = ctypes.c_void_p
+    signatures = {
+        "tsp_version": (ctypes.c_int, []),
+        "tsp_charger": (p, [ctypes.c_char_p]),
+        "tsp_liberer": (None, [p]),
+        "tsp_dimension": (ctypes.c_int, [p]),
+        "tsp_nom": (ctypes.c_char_p, [p]),
+        "tsp_calculer_matrice": (ctypes.c_int, [p]),
+        "tsp_calculer_candidats_alpha": (ctypes.c_int, [p, ctypes.POINTER(ctypes.c_double)]),
+        "tsp_longueur_tournee": (ctypes.c_double, [p, ctypes.POINTER(ctypes.c_int), ctypes.c_int]),
+        "tsp_appliquer_delta": (p, [p, ctypes.c_char_p, ctypes.POINTER(ctypes.c_int), ctypes.c_int]),
+        "tsp_options_creer": (p, []),
+        "tsp_options_liberer": (None, [p]),
+        "tsp_options_definir": (ctypes.c_int, [p, ctypes.c_char_p, ctypes.c_double]),
+        "tsp_resoudre": (p, [p, ctypes.c_char_p, p]),
+        "tsp_resultat_liberer": (None, [p]),
+        "tsp_resultat_longueur": (ctypes.c_double, [p]),
+        "tsp_resultat_temps": (ctypes.c_double, [p]),
+        "tsp_resultat_taille": (ctypes.c_int, [p]),
+        "tsp_resultat_tournee": (ctypes.c_int, [p, ctypes.POINTER(ctypes.c_int), ctypes.c_int]),
+    }
+    for nom, (retour, arguments) in signatures.items():
+        fonction = getattr(lib, nom)
+        fonction.restype = retour
+        fonction.argtypes = arguments
+    return lib
+
+
+_lib = None
+
+
+def bibliotheque(chemin=None):
+    """Charge libtsp.so (une seule fois)"""
+    global _lib
+    if _lib is None:
+        _lib = _declarer(ctypes.CDLL(chemin or os.environ.get("LIBTSP", _chemin_defaut)))
+    return _lib
+
+
+def analyser_methode(texte):
+    """'2optnn -g -r 8 -j 2' -> ('2optnn', {'grille': 1, 'runs': 8, 'threads': 2})"""
+    mots = texte.split()
+    if not mots:
+        raise ErreurTSP("méthode vide")
+    options = {}
+    i = 1
+    while i < len(mots):
+        if mots[i] == "-g":
+            options["grille"] = 1
+        elif mots[i] in _OPTIONS and i + 1 < len(mots):
+            options[_OPTIONS[mots[i]]] = float(mots[i + 1])
+            i += 1
+        else:
+            raise ErreurTSP(f"option '{mots[i]}' non reconnue")
+        i += 1
+    return mots[0], options
+
+
+class Instance:
+    """Instance TSP chargée en mémoire C (fichier TSPLIB, .gz ou binaire)"""
+
+    def __init__(self, fichier, matrice=True, alpha=False):
+        self._lib = bibliotheque()
+        self._instance = self._lib.tsp_charger(fichier.encode())
+        if not self._instance:
+            raise ErreurTSP(f"chargement de '{fichier}' impossible")
+        self.borne = None
+        if matrice:
+            self._lib.tsp_calculer_matrice(self._instance)
+        if alpha:
+            borne = ctypes.c_double()
+            if self._lib.tsp_calculer_candidats_alpha(self._instance, ctypes.byref(borne)) == 0:
+                self.borne = borne.value
+
+    def fermer(self):
+        if self._instance:
+            self._lib.tsp_liberer(self._instance)
+            self._instance = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.fermer()
+
+    def __del__(self):
+        self.fermer()
+
+    @property
+    def dimension(self):
+        return self._lib.tsp_dimension(self._instance)
+
+    @property
+    def nom(self):
+        return self._lib.tsp_nom(self._instance).decode()
+
+    def longueur(self, tournee):
+        """Longueur d'une tournée (numéros TSPLIB), None si elle est invalide"""
+        villes = (ctypes.c_int * len(tournee))(*tournee)
+        longueur = self._lib.tsp_longueur_tournee(self._instance, villes, len(tournee))
+        return None if longueur < 0 else longueur
+
+    def _lire_resultat(self, resultat):
+        """(longueur, temps, tournee) d'un résultat C, libéré ensuite"""
+        try:
+            taille = self._lib.tsp_resultat_taille(resultat)
+            villes = (ctypes.c_int * taille)()
+            self._lib.tsp_resultat_tournee(resultat, villes, taille)
+            return (self._lib.tsp_resultat_longueur(resultat),
+                    self._lib.tsp_resultat_temps(resultat), list(villes))
+        finally:
+            self._lib.tsp_resultat_liberer(resultat)
+
+    def appliquer_delta(self, fichier_delta, tournee):
+        """Applique les ajouts/retraits/déplacements du fichier à l'instance (villes
+        renumérotées) et retourne (longueur, temps, tournee réparée)"""
+        villes = (ctypes.c_int * len(tournee))(*tournee)
+        resultat = self._lib.tsp_appliquer_delta(self._instance, fichier_delta.encode(), villes, len(tournee))
+        if not resultat:
+            raise ErreurTSP(f"delta '{fichier_delta}' non applicable")
+        return self._lire_resultat(resultat)
+
+    def resoudre(self, methode, **options):
+        """Retourne (longueur, temps, tournee) ; 'methode' peut contenir les options -g -r -j -k -t"""
+        nom, depuis_texte = analyser_methode(methode)
+        depuis_texte.update(options)
+        opts = self._lib.tsp_options_creer()
+        try:
+            for cle, valeur in depuis_texte.items():
+                if self._lib.tsp_options_definir(opts, cle.encode(), float(valeur)) != 0:
+                    raise ErreurTSP(f"option '{cle}' inconnue")
+            resultat = self._lib.tsp_resoudre(self._instance, nom.encode(), opts)
+        finally:
+            self._lib.tsp_options_liberer(opts)
+        if not resultat:
+            raise ErreurTSP(f"échec de la méthode '{methode}'")
+        return self._lire_resultat(resultat)
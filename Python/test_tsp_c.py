@@ -3,7 +3,6 @@ Soft ad hoc pour tester les programme C de résolution du tsp
 VD 8/2025
 """
 import random,math
-import subprocess
 import time
 import os
 import sys
@@ -11,32 +10,27 @@ import tsplib95 # fonctions pour lire les fichiers TSPLIB et faire des calculs
 import pyproj # pour les coordonnées géométriques
 import matplotlib.pyplot as plt # pour les graphiques
 from tsp_tools import *
+import libtsp # bibliothèque C (make dans code/)
 
-def extract_data(path,code,filename,method,distance_fct,coord,graphique):
-    # interaction avec C avec subprocess
-    if method == "-c": # canonical
-        command = [path+code, "-f",filename,"-c"]
-    else: # autres balises
-        command = [path+code, "-f",filename,"-m"]+method.split()
-    #print("Commande = ",command) # debug
-    txt = subprocess.run(command,capture_output=True,text=True)
-    lst = txt.stdout.split() # retour du C c'est une chaîne on en fait une liste de chaînes
-    lst = [i for i in lst if i != ":"] # on fait le ménage
-    lst = [i for i in lst if i != ";"]
-    #print("lst = ",lst) # vérif debug
-    try: # analyse de la chaîne renvoyé par subprocess. A adapter à votre cas
-        ind = lst.index('Tour')
-        nom = lst[ind+1]
-        algo = lst[ind+2]
-        tps = eval(lst[ind+3]) # float
-        length = int(eval(lst[ind+4])) # int
-        tour = eval(lst[ind+5]) # liste
+def extract_data(instance_c,method,distance_fct,coord,graphique):
+    # appel direct de la bibliothèque C (libtsp.so) : l'instance est déjà chargée
+    try:
+        if method == "-c": # canonical
+            algo = "canonical"
+            tour = list(range(1,instance_c.dimension+1))
+            tps = 0.0
+            length = int(instance_c.longueur(tour))
+        else: # autres balises
+            algo = method.split()[0]
+            length,tps,tour = instance_c.resoudre(method)
+            length = int(length)
+        nom = instance_c.nom
         l = fitness(tour,distance_fct,coord)
         v = valid(tour)
         print(f"{nom} ; {algo} ; {length} ; {l} ; {tps} ; {tour} ; {v==0} ; {l==length}")
         graphique(tour,algo,coord)
     except Exception as e:
-        print(f"Erreur (Python) e = {e} lst = {lst}")
+        print(f"Erreur (Python) e = {e} method = {method}")
 
 def load_instance(filename):
     # utilise fcts tsplib95
@@ -58,8 +52,9 @@ def test_instance(filename,methods):
 
     print("Instance ; algo ; long (C) ; long (Python) ; temps ; tour ; valid ; mêmes longueurs")
 
-    for m in methods:
-        extract_data(path,code,filename,m,distance_fct,coord,graphique) # l'exécutable C s'appelle tsp dans mon cas.
+    with libtsp.Instance(filename) as instance_c: # chargée une seule fois pour toutes les méthodes
+        for m in methods:
+            extract_data(instance_c,m,distance_fct,coord,graphique)
 
 def tests_instances_list(instances_file,methods):
     # lance le programme C avec toutes les options de methods
@@ -72,8 +67,7 @@ def tests_instances_list(instances_file,methods):
 # opt = tsplib95.load_solution(filename+'.opt.tour') pour charger un fichier solution dans python
 #filename = "burma14.tsp"
 filename = "../Jeux_de_donnees/att10.tsp" #
-path = "../code/" # adaptez à votre cas
-code = "tsp" # nom du programme C
+# libtsp.bibliotheque("../code/libtsp.so") # adaptez à votre cas (défaut : ../code/libtsp.so)
 methods = ["-c","bf"]#"bf","gadpx"
 
 #test_instance(filename,methods) # pour un seul appel
@@ -11,11 +11,14 @@
 #include <float.h>
 #include <time.h>
 #include <math.h>
+#include <pthread.h>
 
 #include "heuristiques.h"
 #include "tsp_utils.h"
 #include "distance.h"
 #include "matrice.h"
+#include "chrono.h"
+#include "mesures.h"
 
 
 //              2-OPTIMISATION                   
@@ -75,22 +78,32 @@ void deux_opt(Tournee* tournee, const InstanceTSP* instance, FonctionDistance di
     bool continuer = true;
     int iterations = 0;
     const int MAX_ITERATIONS = 1000;
+    unsigned long long essais = 0, appliques = 0;
     
-    while (continuer && iterations < MAX_ITERATIONS) {
+    // Avec une échéance, seules l'échéance et l'optimum local arrêtent la recherche
+    bool avec_echeance = echeance_obtenir() > 0.0;
+    while (continuer && (iterations < MAX_ITERATIONS || avec_echeance)) {
         continuer = false;
         iterations++;
         
         for (int i = 0; i < n - 2; i++) {
+            // Échéance vérifiée une fois par ligne : O(n) évaluations entre deux lectures de l'horloge
+            if (echeance_atteinte()) {
+                continuer = false;
+                break;
+            }
             for (int j = i + 2; j < n; j++) {
                 // Éviter le cas où on inverse toute la tournée (j+1 == n && i == 0)
                 if (j == n - 1 && i == 0) continue;
                 
                 double gain = calculer_gain_2opt(instance, tournee, dist_func, i, j);
+                essais++;
                 
                 if (gain > 0.001) {  // Petit epsilon pour éviter les erreurs d'arrondi
                     inverser_segment(tournee->chemin, i + 1, j);
                     
                     tournee->distanceTotale -= gain;
+                    appliques++;
                     
                     //amelioration = true;
                     continuer = true;
@@ -98,4 +111,215 @@ void deux_opt(Tournee* tournee, const InstanceTSP* instance, FonctionDistance di
             }
         }
     }
+    // Comptes reportés une fois, hors de la boucle
+    MESURES_COMPTER(COMPTEUR_2OPT_ESSAIS, essais);
+    MESURES_COMPTER(COMPTEUR_2OPT_APPLIQUES, appliques);
+}
+
+
+//              2-OPT PARALLÈLE (MEILLEURE AMÉLIORATION)
+
+// Mouvement 2-opt : inversion du segment [i+1, j]
+typedef struct {
+    int i;
+    int j;
+    double gain;
+} Mouvement2opt;
+
+// Voisinage partagé par les threads pendant une passe
+typedef struct {
+    const InstanceTSP* instance;
+    const Tournee* tournee;
+    FonctionDistance dist_func;
+    const bool* position_active;    // Arête (p, p+1) touchant une ville active
+    const int* positions_actives;   // Les mêmes positions, triées
+    int nb_positions_actives;
+} Voisinage2opt;
+
+typedef struct {
+    const Voisinage2opt* voisinage;
+    int premier_i;          // Le thread traite i = premier_i, premier_i + pas, ...
+    int pas;
+    Mouvement2opt* mouvements;  // Meilleur mouvement améliorant pour chacun de ses i
+    int nb_mouvements;
+} Evaluation2opt;
+
+static void* evaluer_voisinage_2opt(void* arg) {
+    Evaluation2opt* eval = (Evaluation2opt*)arg;
+    const Voisinage2opt* v = eval->voisinage;
+    int n = v->tournee->taille;
+    unsigned long long essais = 0;
+    eval->nb_mouvements = 0;
+
+    // Répartition cyclique des i : la boucle en j raccourcit quand i augmente
+    for (int i = eval->premier_i; i < n - 2; i += eval->pas) {
+        Mouvement2opt meilleur = { i, -1, 0.001 };
+        if (v->position_active[i]) {
+            // Arête active : toutes les arêtes (j, j+1)
+            for (int j = i + 2; j < n; j++) {
+                if (j == n - 1 && i == 0) continue;
+                double gain = calculer_gain_2opt(v->instance, v->tournee, v->dist_func, i, j);
+                essais++;
+                if (gain > meilleur.gain) {
+                    meilleur.j = j;
+                    meilleur.gain = gain;
+                }
+            }
+        } else {
+            // Arête inchangée : seulement les arêtes actives
+            for (int k = 0; k < v->nb_positions_actives; k++) {
+                int j = v->positions_actives[k];
+                if (j < i + 2) continue;
+                if (j == n - 1 && i == 0) continue;
+                double gain = calculer_gain_2opt(v->instance, v->tournee, v->dist_func, i, j);
+                essais++;
+                if (gain > meilleur.gain) {
+                    meilleur.j = j;
+                    meilleur.gain = gain;
+                }
+            }
+        }
+        if (meilleur.j != -1) {
+            eval->mouvements[eval->nb_mouvements++] = meilleur;
+        }
+    }
+    MESURES_COMPTER(COMPTEUR_2OPT_ESSAIS, essais);
+    return NULL;
+}
+
+static int comparer_mouvements(const void* a, const void* b) {
+    const Mouvement2opt* m1 = (const Mouvement2opt*)a;
+    const Mouvement2opt* m2 = (const Mouvement2opt*)b;
+    if (m1->gain > m2->gain) return -1;
+    if (m1->gain < m2->gain) return 1;
+    return m1->i - m2->i;
+}
+
+static void activer_mouvement(bool* ville_active, const int* chemin, int n, const Mouvement2opt* m) {
+    ville_active[chemin[m->i] - 1] = true;
+    ville_active[chemin[m->i + 1] - 1] = true;
+    ville_active[chemin[m->j] - 1] = true;
+    ville_active[chemin[(m->j + 1) % n] - 1] = true;
+}
+
+/**
+ * 2-opt par lots de mouvements indépendants : à chaque passe, le voisinage
+ * O(n²) est réparti entre nb_threads threads qui retiennent le meilleur
+ * mouvement améliorant pour chaque i. Les mouvements sont ensuite triés par
+ * gain et appliqués séquentiellement s'ils ne chevauchent aucun mouvement
+ * déjà retenu (positions [i, j+1] disjointes), ce qui garde les gains exacts.
+ *
+ * Seules les arêtes touchant une ville modifiée à la passe précédente (ou
+ * porteuse d'un mouvement non retenu) sont comparées à toutes les autres ;
+ * une dernière passe complète confirme l'optimum local.
+ */
+void deux_opt_parallele(Tournee* tournee, const InstanceTSP* instance,
+                        FonctionDistance dist_func, int nb_threads) {
+    int n = tournee->taille;
+    if (n < 4) return;
+    if (nb_threads < 1) nb_threads = 1;
+
+    pthread_t* threads = (pthread_t*)malloc(nb_threads * sizeof(pthread_t));
+    Evaluation2opt* evals = (Evaluation2opt*)calloc(nb_threads, sizeof(Evaluation2opt));
+    Mouvement2opt* lot = (Mouvement2opt*)malloc(n * sizeof(Mouvement2opt));
+    Mouvement2opt* retenus = (Mouvement2opt*)malloc(n * sizeof(Mouvement2opt));
+    bool* ville_active = (bool*)malloc(n * sizeof(bool));
+    bool* position_active = (bool*)malloc(n * sizeof(bool));
+    int* positions_actives = (int*)malloc(n * sizeof(int));
+    bool alloc_ok = threads && evals && lot && retenus && ville_active
+                    && position_active && positions_actives;
+
+    Voisinage2opt voisinage;
+    voisinage.instance = instance;
+    voisinage.tournee = tournee;
+    voisinage.dist_func = dist_func;
+    voisinage.position_active = position_active;
+    voisinage.positions_actives = positions_actives;
+
+    for (int t = 0; alloc_ok && t < nb_threads; t++) {
+        evals[t].voisinage = &voisinage;
+        evals[t].premier_i = t;
+        evals[t].pas = nb_threads;
+        evals[t].mouvements = (Mouvement2opt*)malloc((n / nb_threads + 1) * sizeof(Mouvement2opt));
+        if (!evals[t].mouvements) alloc_ok = false;
+    }
+
+    bool passe_complete = true;
+    if (alloc_ok) {
+        for (int v = 0; v < n; v++) ville_active[v] = true;
+    }
+
+    while (alloc_ok && !echeance_atteinte()) {
+        // Arêtes actives de la passe
+        voisinage.nb_positions_actives = 0;
+        for (int p = 0; p < n; p++) {
+            position_active[p] = ville_active[tournee->chemin[p] - 1]
+                              || ville_active[tournee->chemin[(p + 1) % n] - 1];
+            if (position_active[p]) positions_actives[voisinage.nb_positions_actives++] = p;
+        }
+
+        // Évaluation parallèle (le thread courant traite la part 0, et celles des
+        // threads qui n'ont pu être créés)
+        int nb_lances = 1;
+        while (nb_lances < nb_threads
+               && pthread_create(&threads[nb_lances], NULL, evaluer_voisinage_2opt, &evals[nb_lances]) == 0) {
+            nb_lances++;
+        }
+        for (int t = nb_lances; t < nb_threads; t++) {
+            evaluer_voisinage_2opt(&evals[t]);
+        }
+        evaluer_voisinage_2opt(&evals[0]);
+        for (int t = 1; t < nb_lances; t++) {
+            pthread_join(threads[t], NULL);
+        }
+
+        // Réduction
+        int nb_lot = 0;
+        for (int t = 0; t < nb_threads; t++) {
+            memcpy(lot + nb_lot, evals[t].mouvements, evals[t].nb_mouvements * sizeof(Mouvement2opt));
+            nb_lot += evals[t].nb_mouvements;
+        }
+        if (nb_lot == 0) {
+            if (passe_complete) break;
+            // Vérification : une passe sur tout le voisinage
+            for (int v = 0; v < n; v++) ville_active[v] = true;
+            passe_complete = true;
+            continue;
+        }
+        qsort(lot, nb_lot, sizeof(Mouvement2opt), comparer_mouvements);
+
+        // Sélection des mouvements sans chevauchement
+        int nb_retenus = 0;
+        for (int v = 0; v < n; v++) ville_active[v] = false;
+        for (int m = 0; m < nb_lot; m++) {
+            bool independant = true;
+            for (int r = 0; r < nb_retenus && independant; r++) {
+                if (!(lot[m].j + 1 <= retenus[r].i || retenus[r].j + 1 <= lot[m].i)) {
+                    independant = false;
+                }
+            }
+            if (independant) retenus[nb_retenus++] = lot[m];
+            // Villes à réexaminer à la prochaine passe
+            activer_mouvement(ville_active, tournee->chemin, n, &lot[m]);
+        }
+
+        // Application séquentielle
+        for (int r = 0; r < nb_retenus; r++) {
+            inverser_segment(tournee->chemin, retenus[r].i + 1, retenus[r].j);
+            tournee->distanceTotale -= retenus[r].gain;
+        }
+        MESURES_COMPTER(COMPTEUR_2OPT_APPLIQUES, nb_retenus);
+        passe_complete = false;
+    }
+
+    for (int t = 0; evals && t < nb_threads; t++) {
+        free(evals[t].mouvements);
+    }
+    free(threads);
+    free(evals);
+    free(lot);
+    free(retenus);
+    free(ville_active);
+    free(position_active);
+    free(positions_actives);
 }
\ No newline at end of file
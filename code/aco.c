@@ -0,0 +1,378 @@
+/**
+ * aco.c
+ * Ant Colony System : construction restreinte aux listes de candidats,
+ * fourmis construites en parallèle, mises à jour des phéromones déterministes
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "aco.h"
+#include "heuristiques.h"
+#include "tsp_utils.h"
+#include "matrice.h"
+#include "candidats.h"
+#include "tournee_tableau.h"
+#include "recherche_locale.h"
+#include "alea.h"
+#include "chrono.h"
+
+// Phéromones : matrice triangulaire inférieure "jagged" (même disposition que
+// matrice_distances, en float) ou, pour les grandes instances, une valeur par arête
+// candidate. En mode candidats, les autres arêtes gardent la valeur initiale tau0.
+typedef struct {
+    int n;
+    float** triangulaire;           // triangulaire[i][j], j < i ; NULL en mode candidats
+    float* par_candidat;            // par_candidat[i * k + r] ; NULL en mode dense
+    const ListesCandidats* candidats;
+    float tau0;
+} Pheromones;
+
+// Données partagées par les threads pendant une itération (lecture seule sauf 'fourmis')
+typedef struct {
+    const InstanceTSP* instance;
+    FonctionDistance dist_func;
+    const ParamsACO* params;
+    const ListesCandidats* candidats;
+    const Pheromones* pheromones;
+    const double* attrait;          // attrait[i * k + r] = (1 / d(i, c_r))^beta
+    int iteration;
+    int nb_threads;
+    double echeance;                // Échéance du thread appelant, reprise par chaque thread
+    Tournee** fourmis;
+} TravailACO;
+
+// Espace de travail propre à chaque thread
+typedef struct {
+    TravailACO* travail;
+    int numero;
+    int* non_visitees;              // Villes non visitées (retrait par échange)
+    int* position_non_visitee;
+    TourneeTableau* tableau;
+    RechercheLocale* recherche;
+} ThreadACO;
+
+static bool creer_pheromones(Pheromones* ph, int n, const ListesCandidats* candidats, float tau0) {
+    ph->n = n;
+    ph->candidats = candidats;
+    ph->tau0 = tau0;
+    ph->triangulaire = NULL;
+    ph->par_candidat = NULL;
+
+    if (n <= ACO_DIMENSION_MAX_DENSE) {
+        ph->triangulaire = (float**)calloc(n, sizeof(float*));
+        if (!ph->triangulaire) return false;
+        for (int i = 1; i < n; i++) {
+            ph->triangulaire[i] = (float*)malloc(i * sizeof(float));
+            if (!ph->triangulaire[i]) return false;
+            for (int j = 0; j < i; j++) ph->triangulaire[i][j] = tau0;
+        }
+    } else {
+        size_t taille = (size_t)n * candidats->k;
+        ph->par_candidat = (float*)malloc(taille * sizeof(float));
+        if (!ph->par_candidat) return false;
+        for (size_t e = 0; e < taille; e++) ph->par_candidat[e] = tau0;
+    }
+    return true;
+}
+
+static void liberer_pheromones(Pheromones* ph) {
+    if (ph->triangulaire) {
+        for (int i = 0; i < ph->n; i++) free(ph->triangulaire[i]);
+        free(ph->triangulaire);
+    }
+    free(ph->par_candidat);
+}
+
+// Phéromone de l'arête (i, r-ième candidat de i)
+static float pheromone_candidat(const Pheromones* ph, int i, int r) {
+    if (ph->triangulaire) {
+        int j = ph->candidats->voisins[(size_t)i * ph->candidats->k + r];
+        return i > j ? ph->triangulaire[i][j] : ph->triangulaire[j][i];
+    }
+    return ph->par_candidat[(size_t)i * ph->candidats->k + r];
+}
+
+// Phéromone d'une arête quelconque (i != j)
+static float pheromone(const Pheromones* ph, int i, int j) {
+    if (ph->triangulaire) {
+        return i > j ? ph->triangulaire[i][j] : ph->triangulaire[j][i];
+    }
+    const int* voisins = ph->candidats->voisins + (size_t)i * ph->candidats->k;
+    for (int r = 0; r < ph->candidats->k; r++) {
+        if (voisins[r] == j) return ph->par_candidat[(size_t)i * ph->candidats->k + r];
+    }
+    return ph->tau0;
+}
+
+// tau <- (1 - evaporation) * tau + evaporation * depot, sur l'arête (i, j)
+static void mettre_a_jour(Pheromones* ph, int i, int j, double evaporation, double depot) {
+    if (ph->triangulaire) {
+        float* tau = i > j ? &ph->triangulaire[i][j] : &ph->triangulaire[j][i];
+        *tau = (float)((1.0 - evaporation) * *tau + evaporation * depot);
+        return;
+    }
+    // Mode candidats : l'arête peut figurer dans la liste de i, de j, ou d'aucune
+    int k = ph->candidats->k;
+    for (int sens = 0; sens < 2; sens++) {
+        int a = sens == 0 ? i : j, b = sens == 0 ? j : i;
+        const int* voisins = ph->candidats->voisins + (size_t)a * k;
+        for (int r = 0; r < k; r++) {
+            if (voisins[r] == b) {
+                float* tau = &ph->par_candidat[(size_t)a * k + r];
+                *tau = (float)((1.0 - evaporation) * *tau + evaporation * depot);
+                break;
+            }
+        }
+    }
+}
+
+static void retirer_non_visitee(ThreadACO* donnees, int* nb_restantes, int v) {
+    int pos = donnees->position_non_visitee[v];
+    int derniere = donnees->non_visitees[--(*nb_restantes)];
+    donnees->non_visitees[pos] = derniere;
+    donnees->position_non_visitee[derniere] = pos;
+    donnees->position_non_visitee[v] = -1;
+}
+
+// Règle de transition ACS parmi les candidats non visités ; parcours complet sinon
+static int choisir_suivante(ThreadACO* donnees, Alea* alea, int courante, int nb_restantes) {
+    const TravailACO* travail = donnees->travail;
+    const ParamsACO* params = travail->params;
+    int k = travail->candidats->k;
+    const int* voisins = travail->candidats->voisins + (size_t)courante * k;
+    const double* attrait = travail->attrait + (size_t)courante * k;
+    double poids[k];
+    double total = 0.0, meilleur_poids = -1.0;
+    int meilleure = -1;
+
+    for (int r = 0; r < k; r++) {
+        poids[r] = 0.0;
+        if (donnees->position_non_visitee[voisins[r]] < 0) continue;
+        double tau = pheromone_candidat(travail->pheromones, courante, r);
+        poids[r] = (params->alpha == 1.0 ? tau : pow(tau, params->alpha)) * attrait[r];
+        total += poids[r];
+        if (poids[r] > meilleur_poids) {
+            meilleur_poids = poids[r];
+            meilleure = voisins[r];
+        }
+    }
+
+    if (meilleure >= 0) {
+        if (alea_reel(alea) < params->q0) return meilleure;
+        // Exploration : roulette proportionnelle aux poids
+        double tirage = alea_reel(alea) * total;
+        for (int r = 0; r < k; r++) {
+            if (poids[r] <= 0.0) continue;
+            tirage -= poids[r];
+            if (tirage <= 0.0) return voisins[r];
+        }
+        return meilleure;
+    }
+
+    // Tous les candidats sont visités : meilleur poids parmi toutes les villes restantes
+    // (aucune n'est candidate de la ville courante : en mode candidats, tau = tau0)
+    for (int p = 0; p < nb_restantes; p++) {
+        int v = donnees->non_visitees[p];
+        double d = distance_villes(travail->instance, travail->dist_func, courante, v) + 1e-10;
+        double tau = travail->pheromones->triangulaire
+                   ? pheromone(travail->pheromones, courante, v) : travail->pheromones->tau0;
+        double w = (params->alpha == 1.0 ? tau : pow(tau, params->alpha))
+                 * (params->beta == 2.0 ? 1.0 / (d * d) : pow(1.0 / d, params->beta));
+        if (w > meilleur_poids || (w == meilleur_poids && v < meilleure)) {
+            meilleur_poids = w;
+            meilleure = v;
+        }
+    }
+    return meilleure;
+}
+
+static void construire_fourmi(ThreadACO* donnees, int fourmi) {
+    const TravailACO* travail = donnees->travail;
+    int n = travail->instance->dimension;
+    Tournee* tournee = travail->fourmis[fourmi];
+
+    // Graine propre à (itération, fourmi) : indépendante du nombre de threads
+    Alea alea;
+    alea_initialiser(&alea, travail->params->graine
+                            + (uint64_t)travail->iteration * travail->params->nb_fourmis + fourmi);
+
+    for (int v = 0; v < n; v++) {
+        donnees->non_visitees[v] = v;
+        donnees->position_non_visitee[v] = v;
+    }
+    int nb_restantes = n;
+    int courante = alea_entier(&alea, n);
+    retirer_non_visitee(donnees, &nb_restantes, courante);
+    tournee->chemin[0] = courante + 1;
+    for (int etape = 1; etape < n; etape++) {
+        courante = choisir_suivante(donnees, &alea, courante, nb_restantes);
+        retirer_non_visitee(donnees, &nb_restantes, courante);
+        tournee->chemin[etape] = courante + 1;
+    }
+
+    if (donnees->recherche) {
+        tableau_depuis_tournee(donnees->tableau, tournee);
+        recherche_locale_activer_tout(donnees->recherche);
+        recherche_locale_optimiser(donnees->recherche);
+        tableau_vers_tournee(donnees->tableau, tournee);
+    }
+    calculer_longueur_tournee(tournee, travail->instance, travail->dist_func);
+}
+
+static void* thread_fourmis(void* arg) {
+    ThreadACO* donnees = (ThreadACO*)arg;
+    const TravailACO* travail = donnees->travail;
+    echeance_definir(travail->echeance);
+    // Répartition cyclique des fourmis entre les threads
+    for (int f = donnees->numero; f < travail->params->nb_fourmis; f += travail->nb_threads) {
+        construire_fourmi(donnees, f);
+    }
+    return NULL;
+}
+
+void params_aco_defaut(ParamsACO* params) {
+    params->nb_fourmis = 10;
+    params->nb_iterations = 200;
+    params->alpha = 1.0;
+    params->beta = 2.0;
+    params->q0 = 0.9;
+    params->rho = 0.1;
+    params->xi = 0.1;
+    params->recherche_locale = true;
+    params->graine = 2025;
+}
+
+Tournee* colonie_fourmis(const InstanceTSP* instance, FonctionDistance dist_func,
+                         const ParamsACO* params, int nb_threads) {
+    int n = instance->dimension;
+    if (n < 8) return plus_proche_voisin(instance, dist_func);
+    if (nb_threads < 1) nb_threads = 1;
+    if (nb_threads > params->nb_fourmis) nb_threads = params->nb_fourmis;
+
+    Tournee* meilleure = plus_proche_voisin_grille(instance, dist_func);
+    ListesCandidats* candidats = candidats_recherche_locale(instance, dist_func);
+    if (!meilleure || !candidats) {
+        liberer_candidats(candidats);
+        return meilleure;
+    }
+    int k = candidats->k;
+
+    // ACS : tau0 = 1 / (n * L_nn)
+    Pheromones pheromones;
+    bool ok = creer_pheromones(&pheromones, n, candidats,
+                               (float)(1.0 / (n * meilleure->distanceTotale)));
+
+    double* attrait = (double*)malloc((size_t)n * k * sizeof(double));
+    Tournee** fourmis = (Tournee**)calloc(params->nb_fourmis, sizeof(Tournee*));
+    pthread_t* threads = (pthread_t*)malloc(nb_threads * sizeof(pthread_t));
+    ThreadACO* donnees = (ThreadACO*)calloc(nb_threads, sizeof(ThreadACO));
+    ok = ok && attrait && fourmis && threads && donnees;
+    for (int f = 0; ok && f < params->nb_fourmis; f++) {
+        fourmis[f] = creer_tournee(n);
+        ok = fourmis[f] != NULL;
+    }
+
+    TravailACO travail;
+    travail.instance = instance;
+    travail.dist_func = dist_func;
+    travail.params = params;
+    travail.candidats = candidats;
+    travail.pheromones = &pheromones;
+    travail.attrait = attrait;
+    travail.nb_threads = nb_threads;
+    travail.echeance = echeance_obtenir();
+    travail.fourmis = fourmis;
+
+    for (int t = 0; ok && t < nb_threads; t++) {
+        donnees[t].travail = &travail;
+        donnees[t].numero = t;
+        donnees[t].non_visitees = (int*)malloc(n * sizeof(int));
+        donnees[t].position_non_visitee = (int*)malloc(n * sizeof(int));
+        ok = donnees[t].non_visitees && donnees[t].position_non_visitee;
+        if (ok && params->recherche_locale) {
+            donnees[t].tableau = creer_tournee_tableau(meilleure);
+            donnees[t].recherche = donnees[t].tableau
+                ? creer_recherche_locale(instance, dist_func, candidats, donnees[t].tableau) : NULL;
+            ok = donnees[t].recherche != NULL;
+        }
+    }
+
+    if (ok) {
+        for (int i = 0; i < n; i++) {
+            for (int r = 0; r < k; r++) {
+                double d = distance_villes(instance, dist_func, i, candidats->voisins[(size_t)i * k + r]);
+                attrait[(size_t)i * k + r] = pow(1.0 / (d + 1e-10), params->beta);
+            }
+        }
+
+        for (int it = 0; it < params->nb_iterations && !echeance_atteinte(); it++) {
+            travail.iteration = it;
+
+            // Construction parallèle (le thread courant traite la part 0, et celles
+            // des threads qui n'ont pu être créés) ; les phéromones ne sont lues que
+            // pendant cette phase
+            int nb_lances = 1;
+            while (nb_lances < nb_threads
+                   && pthread_create(&threads[nb_lances], NULL, thread_fourmis, &donnees[nb_lances]) == 0) {
+                nb_lances++;
+            }
+            for (int t = nb_lances; t < nb_threads; t++) {
+                thread_fourmis(&donnees[t]);
+            }
+            thread_fourmis(&donnees[0]);
+            for (int t = 1; t < nb_lances; t++) {
+                pthread_join(threads[t], NULL);
+            }
+
+            // Mise à jour locale différée, dans l'ordre des fourmis
+            for (int f = 0; f < params->nb_fourmis; f++) {
+                const int* chemin = fourmis[f]->chemin;
+                for (int i = 0; i < n; i++) {
+                    mettre_a_jour(&pheromones, chemin[i] - 1, chemin[(i + 1) % n] - 1,
+                                  params->xi, pheromones.tau0);
+                }
+            }
+
+            // Meilleure tournée (à égalité, la fourmi de plus petit numéro)
+            for (int f = 0; f < params->nb_fourmis; f++) {
+                if (fourmis[f]->distanceTotale < meilleure->distanceTotale - 1e-9) {
+                    copier_tournee(meilleure, fourmis[f]);
+                }
+            }
+
+            // Mise à jour globale sur les arêtes de la meilleure tournée
+            double depot = 1.0 / meilleure->distanceTotale;
+            for (int i = 0; i < n; i++) {
+                mettre_a_jour(&pheromones, meilleure->chemin[i] - 1,
+                              meilleure->chemin[(i + 1) % n] - 1, params->rho, depot);
+            }
+        }
+
+        // La tournée commence par la ville 1, comme celles des autres méthodes
+        int debut = 0;
+        while (meilleure->chemin[debut] != 1) debut++;
+        for (int i = 0; i < n; i++) fourmis[0]->chemin[i] = meilleure->chemin[(debut + i) % n];
+        copier_tournee(meilleure, fourmis[0]);
+        calculer_longueur_tournee(meilleure, instance, dist_func);
+    } else {
+        fprintf(stderr, "Erreur: Allocation mémoire pour la colonie de fourmis\n");
+    }
+
+    for (int t = 0; donnees && t < nb_threads; t++) {
+        free(donnees[t].non_visitees);
+        free(donnees[t].position_non_visitee);
+        liberer_recherche_locale(donnees[t].recherche);
+        liberer_tournee_tableau(donnees[t].tableau);
+    }
+    for (int f = 0; fourmis && f < params->nb_fourmis; f++) liberer_tournee(fourmis[f]);
+    free(donnees);
+    free(threads);
+    free(fourmis);
+    free(attrait);
+    liberer_pheromones(&pheromones);
+    liberer_candidats(candidats);
+    return meilleure;
+}
@@ -0,0 +1,32 @@
+#ifndef ACO_H
+#define ACO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "tsp.h"
+
+// Au-delà, les phéromones ne sont stockées que sur les arêtes candidates (n·k flottants)
+// au lieu de la matrice triangulaire (n²/2 flottants)
+#define ACO_DIMENSION_MAX_DENSE 5000
+
+// Paramètres de l'Ant Colony System
+typedef struct {
+    int nb_fourmis;
+    int nb_iterations;
+    double alpha;               // Poids des phéromones (1 dans ACS)
+    double beta;                // Poids de l'heuristique 1/d
+    double q0;                  // Probabilité de choix glouton (exploitation)
+    double rho;                 // Évaporation globale
+    double xi;                  // Évaporation locale
+    bool recherche_locale;      // 2-opt + Or-opt sur chaque tournée construite
+    uint64_t graine;
+} ParamsACO;
+
+void params_aco_defaut(ParamsACO* params);
+
+// Ant Colony System : les fourmis d'une itération sont construites en parallèle sur
+// nb_threads threads ; le résultat ne dépend pas du nombre de threads.
+Tournee* colonie_fourmis(const InstanceTSP* instance, FonctionDistance dist_func,
+                         const ParamsACO* params, int nb_threads);
+
+#endif
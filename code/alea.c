@@ -0,0 +1,27 @@
+#include "alea.h"
+
+void alea_initialiser(Alea* alea, uint64_t graine) {
+    // splitmix64 : évite un état nul et décorrèle les graines voisines
+    uint64_t z = graine + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z = z ^ (z >> 31);
+    alea->etat = z ? z : 0x2545F4914F6CDD1DULL;
+}
+
+uint64_t alea_suivant(Alea* alea) {
+    uint64_t x = alea->etat;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    alea->etat = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+int alea_entier(Alea* alea, int borne) {
+    return (int)((alea_suivant(alea) >> 33) % (uint64_t)borne);
+}
+
+double alea_reel(Alea* alea) {
+    return (alea_suivant(alea) >> 11) * (1.0 / 9007199254740992.0);
+}
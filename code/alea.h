@@ -0,0 +1,21 @@
+#ifndef ALEA_H
+#define ALEA_H
+
+#include <stdint.h>
+
+// Générateur pseudo-aléatoire xorshift64* : un état par thread, reproductible
+typedef struct Alea {
+    uint64_t etat;
+} Alea;
+
+void alea_initialiser(Alea* alea, uint64_t graine);
+
+uint64_t alea_suivant(Alea* alea);
+
+// Entier uniforme dans [0, borne)
+int alea_entier(Alea* alea, int borne);
+
+// Réel uniforme dans [0, 1)
+double alea_reel(Alea* alea);
+
+#endif
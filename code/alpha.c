@@ -0,0 +1,532 @@
+/**
+ * alpha.c
+ * Borne de Held-Karp par sous-gradient sur les 1-arbres et
+ * listes de candidats par alpha-nearness
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+
+#include "alpha.h"
+#include "heuristiques.h"
+#include "tsp_utils.h"
+#include "matrice.h"
+#include "tas.h"
+
+// Graphe restreint du sous-gradient : plus proches voisins et plus proches voisins
+// par quadrant, symétrisés
+#define ALPHA_VOISINS_GRAPHE 10
+#define ALPHA_VOISINS_QUADRANT 2
+#define ALPHA_ITERATIONS_MAX 1000
+// Itérations sans amélioration de la borne avant de diviser le pas par deux
+#define ALPHA_PATIENCE 30
+#define ALPHA_PAS_MIN 1e-3
+
+// 1-arbre : arbre couvrant des villes 1..n-1 (racine 1) et deux arêtes vers la ville 0
+typedef struct {
+    const InstanceTSP* instance;
+    FonctionDistance dist_func;
+    const GrapheCandidats* graphe;  // NULL : graphe complet
+    double* pi;                     // Pénalités des villes
+    int* parent;
+    double* cout_parent;            // Coût modifié de l'arête (v, parent[v])
+    int* degre;
+    int premier, second;            // Voisins de la ville 0, par coût croissant
+    double cout_premier, cout_second;
+    TasBinaire* tas;
+    double* cle;
+    bool* dans_arbre;
+} UnArbre;
+
+static double cout_modifie(const UnArbre* a, int i, int j) {
+    return distance_villes(a->instance, a->dist_func, i, j) + a->pi[i] + a->pi[j];
+}
+
+// Prim en O(n²) sur le graphe complet
+static void arbre_dense(UnArbre* a) {
+    int n = a->instance->dimension;
+    for (int v = 0; v < n; v++) {
+        a->cle[v] = DBL_MAX;
+        a->parent[v] = -1;
+        a->dans_arbre[v] = (v == 0);
+    }
+    a->cle[1] = 0.0;
+    a->cout_parent[1] = 0.0;
+
+    for (int iter = 1; iter < n; iter++) {
+        int u = -1;
+        for (int v = 1; v < n; v++) {
+            if (!a->dans_arbre[v] && (u == -1 || a->cle[v] < a->cle[u])) u = v;
+        }
+        a->dans_arbre[u] = true;
+        for (int v = 1; v < n; v++) {
+            if (a->dans_arbre[v]) continue;
+            double c = cout_modifie(a, u, v);
+            if (c < a->cle[v]) {
+                a->cle[v] = c;
+                a->parent[v] = u;
+                a->cout_parent[v] = c;
+            }
+        }
+    }
+}
+
+// Prim avec tas sur le graphe restreint ; une composante non atteinte est
+// rattachée à la ville de l'arbre la moins chère
+static void arbre_creux(UnArbre* a) {
+    int n = a->instance->dimension;
+    const GrapheCandidats* graphe = a->graphe;
+    for (int v = 0; v < n; v++) {
+        a->tas->cle[v] = DBL_MAX;
+        a->parent[v] = -1;
+        a->dans_arbre[v] = (v == 0);
+    }
+    a->cout_parent[1] = 0.0;
+
+    int nb_dans_arbre = 1;
+    int prochain_hors_arbre = 1;
+    tas_diminuer(a->tas, 1, 0.0);
+
+    while (nb_dans_arbre < n) {
+        if (a->tas->taille == 0) {
+            while (a->dans_arbre[prochain_hors_arbre]) prochain_hors_arbre++;
+            int v = prochain_hors_arbre;
+            double cout_min = DBL_MAX;
+            for (int u = 1; u < n; u++) {
+                if (!a->dans_arbre[u]) continue;
+                double c = cout_modifie(a, u, v);
+                if (c < cout_min) {
+                    cout_min = c;
+                    a->parent[v] = u;
+                    a->cout_parent[v] = c;
+                }
+            }
+            tas_diminuer(a->tas, v, cout_min);
+        }
+
+        int u = tas_extraire(a->tas);
+        a->dans_arbre[u] = true;
+        nb_dans_arbre++;
+
+        for (int p = graphe->debut[u]; p < graphe->debut[u + 1]; p++) {
+            int v = graphe->voisins[p];
+            if (a->dans_arbre[v]) continue;
+            double c = cout_modifie(a, u, v);
+            if (c < a->tas->cle[v]) {
+                a->parent[v] = u;
+                a->cout_parent[v] = c;
+                tas_diminuer(a->tas, v, c);
+            }
+        }
+    }
+}
+
+// Calcule le 1-arbre pour les pénalités courantes et retourne sa valeur L(pi)
+static double un_arbre(UnArbre* a) {
+    int n = a->instance->dimension;
+    if (a->graphe) arbre_creux(a);
+    else arbre_dense(a);
+
+    // Deux arêtes les moins chères de la ville 0
+    a->premier = a->second = -1;
+    a->cout_premier = a->cout_second = DBL_MAX;
+    int nb_voisins = a->graphe ? a->graphe->debut[1] - a->graphe->debut[0] : n - 1;
+    for (int p = 0; p < nb_voisins; p++) {
+        int v = a->graphe ? a->graphe->voisins[a->graphe->debut[0] + p] : p + 1;
+        if (v == a->premier || v == a->second) continue;
+        double c = cout_modifie(a, 0, v);
+        if (c < a->cout_premier) {
+            a->second = a->premier;
+            a->cout_second = a->cout_premier;
+            a->premier = v;
+            a->cout_premier = c;
+        } else if (c < a->cout_second) {
+            a->second = v;
+            a->cout_second = c;
+        }
+    }
+
+    double valeur = a->cout_premier + a->cout_second;
+    memset(a->degre, 0, n * sizeof(int));
+    a->degre[0] = 2;
+    a->degre[a->premier]++;
+    a->degre[a->second]++;
+    for (int v = 2; v < n; v++) {
+        if (a->parent[v] < 0) continue;
+        valeur += a->cout_parent[v];
+        a->degre[v]++;
+        a->degre[a->parent[v]]++;
+    }
+    for (int v = 0; v < n; v++) valeur -= 2.0 * a->pi[v];
+    return valeur;
+}
+
+// Optimisation des pénalités : pas de Polyak (majorant : plus proche voisin),
+// direction 0,7 g + 0,3 g_précédent pour amortir les oscillations.
+// Meilleure borne dans 'borne_max' ; faux si l'allocation échoue.
+static bool sous_gradient(UnArbre* a, double majorant, double* borne_max) {
+    int n = a->instance->dimension;
+    double* meilleures_pi = (double*)calloc(n, sizeof(double));
+    int* degre_precedent = (int*)malloc(n * sizeof(int));
+    if (!meilleures_pi || !degre_precedent) {
+        free(meilleures_pi);
+        free(degre_precedent);
+        return false;
+    }
+    for (int v = 0; v < n; v++) degre_precedent[v] = 2;
+    double meilleure_borne = -DBL_MAX;
+    double lambda = 2.0;
+    int sans_progres = 0;
+
+    for (int it = 0; it < ALPHA_ITERATIONS_MAX; it++) {
+        double borne = un_arbre(a);
+        if (borne > meilleure_borne + 1e-9) {
+            meilleure_borne = borne;
+            memcpy(meilleures_pi, a->pi, n * sizeof(double));
+            sans_progres = 0;
+        } else if (++sans_progres >= ALPHA_PATIENCE) {
+            // Pas divisé par deux, reprise depuis les meilleures pénalités
+            lambda /= 2.0;
+            sans_progres = 0;
+            if (lambda < ALPHA_PAS_MIN) break;
+            memcpy(a->pi, meilleures_pi, n * sizeof(double));
+            continue;
+        }
+
+        double norme = 0.0;
+        for (int v = 0; v < n; v++) {
+            norme += (double)(a->degre[v] - 2) * (a->degre[v] - 2);
+        }
+        // 1-arbre réduit à une tournée : la borne est optimale
+        if (norme == 0.0 || majorant <= borne) break;
+
+        double pas = lambda * (majorant - borne) / norme;
+        for (int v = 0; v < n; v++) {
+            a->pi[v] += pas * (0.7 * (a->degre[v] - 2) + 0.3 * (degre_precedent[v] - 2));
+            degre_precedent[v] = a->degre[v];
+        }
+    }
+
+    memcpy(a->pi, meilleures_pi, n * sizeof(double));
+    free(meilleures_pi);
+    free(degre_precedent);
+    *borne_max = meilleure_borne;
+    return true;
+}
+
+// Insertion triée (alpha puis coût) dans les k meilleurs, sans doublon
+static void inserer_candidat(int* voisins, double* alphas, double* couts, int* nb, int k,
+                             int j, double alpha, double c) {
+    if (*nb == k && (alpha > alphas[k - 1] || (alpha == alphas[k - 1] && c >= couts[k - 1]))) {
+        return;
+    }
+    for (int e = 0; e < *nb; e++) {
+        if (voisins[e] == j) return;
+    }
+    int pos = (*nb < k) ? (*nb)++ : k - 1;
+    while (pos > 0 && (alphas[pos - 1] > alpha || (alphas[pos - 1] == alpha && couts[pos - 1] > c))) {
+        voisins[pos] = voisins[pos - 1];
+        alphas[pos] = alphas[pos - 1];
+        couts[pos] = couts[pos - 1];
+        pos--;
+    }
+    voisins[pos] = j;
+    alphas[pos] = alpha;
+    couts[pos] = c;
+}
+
+// alpha d'une arête (0, j) : nulle pour les deux arêtes du 1-arbre,
+// sinon elle remplacerait la plus chère des deux
+static double alpha_special(const UnArbre* a, int j, double c) {
+    if (j == a->premier || j == a->second) return 0.0;
+    return c - a->cout_second;
+}
+
+// Enfants de chaque ville dans l'arbre (format CSR). Faux si l'allocation échoue.
+static bool construire_enfants(const UnArbre* a, int* debut, int* enfants) {
+    int n = a->instance->dimension;
+    memset(debut, 0, (n + 1) * sizeof(int));
+    for (int v = 2; v < n; v++) {
+        if (a->parent[v] >= 0) debut[a->parent[v] + 1]++;
+    }
+    for (int v = 0; v < n; v++) debut[v + 1] += debut[v];
+    int* remplissage = (int*)calloc(n, sizeof(int));
+    if (!remplissage) return false;
+    for (int v = 2; v < n; v++) {
+        int p = a->parent[v];
+        if (p >= 0) enfants[debut[p] + remplissage[p]++] = v;
+    }
+    free(remplissage);
+    return true;
+}
+
+// alpha exactes : pour chaque ville i, parcours de l'arbre depuis i en propageant
+// la plus grande arête du chemin (beta), puis alpha(i, j) = c(i, j) - beta(j). O(n²).
+// Faux si l'allocation échoue.
+static bool alpha_dense(const UnArbre* a, ListesCandidats* candidats) {
+    int n = a->instance->dimension;
+    int k = candidats->k;
+    int* debut = (int*)malloc((n + 1) * sizeof(int));
+    int* enfants = (int*)malloc(n * sizeof(int));
+    double* beta = (double*)malloc(n * sizeof(double));
+    int* pile = (int*)malloc(n * sizeof(int));
+    int* visite = (int*)malloc(n * sizeof(int));
+    double* alphas = (double*)malloc(k * sizeof(double));
+    double* couts = (double*)malloc(k * sizeof(double));
+    if (!debut || !enfants || !beta || !pile || !visite || !alphas || !couts
+        || !construire_enfants(a, debut, enfants)) {
+        free(debut);
+        free(enfants);
+        free(beta);
+        free(pile);
+        free(visite);
+        free(alphas);
+        free(couts);
+        return false;
+    }
+    for (int v = 0; v < n; v++) visite[v] = -1;
+
+    for (int i = 0; i < n; i++) {
+        int* voisins = candidats->voisins + (size_t)i * k;
+        int nb = 0;
+        if (i == 0) {
+            for (int j = 1; j < n; j++) {
+                double c = cout_modifie(a, 0, j);
+                inserer_candidat(voisins, alphas, couts, &nb, k, j, alpha_special(a, j, c), c);
+            }
+            continue;
+        }
+
+        int sommet = 0;
+        pile[sommet++] = i;
+        visite[i] = i;
+        beta[i] = -DBL_MAX;
+        while (sommet > 0) {
+            int v = pile[--sommet];
+            int p = a->parent[v];
+            if (p >= 0 && visite[p] != i) {
+                visite[p] = i;
+                beta[p] = beta[v] > a->cout_parent[v] ? beta[v] : a->cout_parent[v];
+                pile[sommet++] = p;
+            }
+            for (int e = debut[v]; e < debut[v + 1]; e++) {
+                int w = enfants[e];
+                if (visite[w] == i) continue;
+                visite[w] = i;
+                beta[w] = beta[v] > a->cout_parent[w] ? beta[v] : a->cout_parent[w];
+                pile[sommet++] = w;
+            }
+        }
+
+        for (int j = 0; j < n; j++) {
+            if (j == i) continue;
+            double c = cout_modifie(a, i, j);
+            double alpha = (j == 0) ? alpha_special(a, i, c) : c - beta[j];
+            inserer_candidat(voisins, alphas, couts, &nb, k, j, alpha, c);
+        }
+    }
+
+    free(debut);
+    free(enfants);
+    free(beta);
+    free(pile);
+    free(visite);
+    free(alphas);
+    free(couts);
+    return true;
+}
+
+// alpha restreintes aux voisins du graphe et de l'arbre ; la plus grande arête
+// du chemin est obtenue par remontée binaire vers l'ancêtre commun. O(n k log n).
+// Faux si l'allocation échoue.
+static bool alpha_creux(const UnArbre* a, ListesCandidats* candidats) {
+    int n = a->instance->dimension;
+    int k = candidats->k;
+    const GrapheCandidats* graphe = a->graphe;
+    int niveaux = 1;
+    while ((1 << niveaux) < n) niveaux++;
+
+    int* debut = (int*)malloc((n + 1) * sizeof(int));
+    int* enfants = (int*)malloc(n * sizeof(int));
+    int* profondeur = (int*)calloc(n, sizeof(int));
+    int* file = (int*)malloc(n * sizeof(int));
+    int* ancetre = (int*)malloc((size_t)niveaux * n * sizeof(int));
+    double* maximum = (double*)malloc((size_t)niveaux * n * sizeof(double));
+    double* alphas = (double*)malloc(k * sizeof(double));
+    double* couts = (double*)malloc(k * sizeof(double));
+    if (!debut || !enfants || !profondeur || !file || !ancetre || !maximum || !alphas || !couts
+        || !construire_enfants(a, debut, enfants)) {
+        free(debut);
+        free(enfants);
+        free(profondeur);
+        free(file);
+        free(ancetre);
+        free(maximum);
+        free(alphas);
+        free(couts);
+        return false;
+    }
+
+    // Parcours en largeur depuis la racine 1 : profondeurs et premier niveau
+    int tete = 0, queue = 0;
+    file[queue++] = 1;
+    ancetre[1] = 1;
+    maximum[1] = 0.0;
+    while (tete < queue) {
+        int v = file[tete++];
+        for (int e = debut[v]; e < debut[v + 1]; e++) {
+            int w = enfants[e];
+            profondeur[w] = profondeur[v] + 1;
+            ancetre[w] = v;
+            maximum[w] = a->cout_parent[w];
+            file[queue++] = w;
+        }
+    }
+    ancetre[0] = 0;
+    maximum[0] = 0.0;
+    for (int l = 1; l < niveaux; l++) {
+        int* anc = ancetre + (size_t)l * n;
+        const int* anc_prec = ancetre + (size_t)(l - 1) * n;
+        double* mx = maximum + (size_t)l * n;
+        const double* mx_prec = maximum + (size_t)(l - 1) * n;
+        for (int v = 0; v < n; v++) {
+            int m = anc_prec[v];
+            anc[v] = anc_prec[m];
+            mx[v] = mx_prec[v] > mx_prec[m] ? mx_prec[v] : mx_prec[m];
+        }
+    }
+
+    for (int i = 0; i < n; i++) {
+        int* voisins = candidats->voisins + (size_t)i * k;
+        int nb = 0;
+
+        // Voisins de l'arbre (alpha nulle) puis voisins du graphe
+        int nb_pool = graphe->debut[i + 1] - graphe->debut[i];
+        int nb_arbre = (i == 0) ? 2 : debut[i + 1] - debut[i] + 1;
+        for (int e = 0; e < nb_arbre + nb_pool; e++) {
+            int j;
+            if (e < nb_arbre) {
+                if (i == 0) j = (e == 0) ? a->premier : a->second;
+                else if (e == 0) j = a->parent[i];
+                else j = enfants[debut[i] + e - 1];
+            } else {
+                j = graphe->voisins[graphe->debut[i] + e - nb_arbre];
+            }
+            if (j < 0 || j == i) continue;
+
+            double c = cout_modifie(a, i, j);
+            double alpha;
+            if (i == 0 || j == 0) {
+                alpha = alpha_special(a, i == 0 ? j : i, c);
+            } else {
+                // Plus grande arête du chemin de i à j dans l'arbre
+                int u = i, v = j;
+                double beta = 0.0;
+                if (profondeur[u] < profondeur[v]) { int t = u; u = v; v = t; }
+                for (int l = niveaux - 1; l >= 0; l--) {
+                    if (profondeur[u] - (1 << l) >= profondeur[v]) {
+                        double m = maximum[(size_t)l * n + u];
+                        if (m > beta) beta = m;
+                        u = ancetre[(size_t)l * n + u];
+                    }
+                }
+                if (u != v) {
+                    for (int l = niveaux - 1; l >= 0; l--) {
+                        int au = ancetre[(size_t)l * n + u], av = ancetre[(size_t)l * n + v];
+                        if (au != av) {
+                            double mu = maximum[(size_t)l * n + u], mv = maximum[(size_t)l * n + v];
+                            if (mu > beta) beta = mu;
+                            if (mv > beta) beta = mv;
+                            u = au;
+                            v = av;
+                        }
+                    }
+                    if (maximum[u] > beta) beta = maximum[u];
+                    if (maximum[v] > beta) beta = maximum[v];
+                }
+                alpha = c - beta;
+            }
+            inserer_candidat(voisins, alphas, couts, &nb, k, j, alpha, c);
+        }
+    }
+
+    free(debut);
+    free(enfants);
+    free(profondeur);
+    free(file);
+    free(ancetre);
+    free(maximum);
+    free(alphas);
+    free(couts);
+    return true;
+}
+
+ListesCandidats* calculer_candidats_alpha(const InstanceTSP* instance, FonctionDistance dist_func,
+                                          int k, double* borne_inferieure, bool* borne_exacte) {
+    int n = instance->dimension;
+    if (k > n - 1) k = n - 1;
+    if (n < 3 || k < 2) return NULL;
+
+    int k_graphe = k > ALPHA_VOISINS_GRAPHE ? k : ALPHA_VOISINS_GRAPHE;
+    ListesCandidats* proches = calculer_candidats_quadrants(instance, dist_func, k_graphe,
+                                                            ALPHA_VOISINS_QUADRANT);
+    GrapheCandidats* graphe = proches ? creer_graphe_candidats(proches) : NULL;
+    Tournee* majorant = plus_proche_voisin_grille(instance, dist_func);
+
+    UnArbre a;
+    a.instance = instance;
+    a.dist_func = dist_func;
+    a.graphe = graphe;
+    a.pi = (double*)calloc(n, sizeof(double));
+    a.parent = (int*)malloc(n * sizeof(int));
+    a.cout_parent = (double*)malloc(n * sizeof(double));
+    a.degre = (int*)malloc(n * sizeof(int));
+    a.cle = (double*)malloc(n * sizeof(double));
+    a.dans_arbre = (bool*)malloc(n * sizeof(bool));
+    a.tas = creer_tas(n);
+
+    ListesCandidats* candidats = (ListesCandidats*)malloc(sizeof(ListesCandidats));
+    if (candidats) {
+        candidats->n = n;
+        candidats->k = k;
+        candidats->triee_par_distance = false;      // Triés par alpha
+        candidats->voisins = (int*)malloc((size_t)n * k * sizeof(int));
+    }
+
+    bool ok = graphe && majorant && a.pi && a.parent && a.cout_parent && a.degre && a.cle
+           && a.dans_arbre && a.tas && candidats && candidats->voisins;
+    if (ok) {
+        // Sous-gradient sur le graphe restreint, 1-arbre final sur le graphe complet si possible
+        double borne = 0.0;
+        ok = sous_gradient(&a, majorant->distanceTotale, &borne);
+        *borne_exacte = (n <= ALPHA_DIMENSION_MAX_DENSE);
+        if (ok && *borne_exacte) {
+            a.graphe = NULL;
+            borne = un_arbre(&a);
+            ok = alpha_dense(&a, candidats);
+        } else if (ok) {
+            un_arbre(&a);
+            ok = alpha_creux(&a, candidats);
+        }
+        *borne_inferieure = borne;
+    }
+    if (!ok) {
+        fprintf(stderr, "Erreur: Allocation mémoire pour les candidats alpha\n");
+        liberer_candidats(candidats);
+        candidats = NULL;
+    }
+
+    free(a.pi);
+    free(a.parent);
+    free(a.cout_parent);
+    free(a.degre);
+    free(a.cle);
+    free(a.dans_arbre);
+    liberer_tas(a.tas);
+    liberer_graphe_candidats(graphe);
+    liberer_candidats(proches);
+    liberer_tournee(majorant);
+    return candidats;
+}
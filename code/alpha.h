@@ -0,0 +1,22 @@
+#ifndef ALPHA_H
+#define ALPHA_H
+
+#include <stdbool.h>
+#include "tsp.h"
+#include "candidats.h"
+
+// Jusqu'à ce seuil, le 1-arbre final est calculé sur le graphe complet (borne valide)
+// et les valeurs alpha sont exactes ; au-delà, tout est restreint au graphe des candidats
+#define ALPHA_DIMENSION_MAX_DENSE 5000
+
+/**
+ * Optimisation par sous-gradient de la borne de Held-Karp (1-arbres à coûts
+ * d(i,j) + pi[i] + pi[j]), puis, pour chaque ville, les k villes de plus petite
+ * alpha-nearness : alpha(i,j) = coût de (i,j) moins la plus grande arête du
+ * chemin de i à j dans le 1-arbre (0 pour les arêtes de l'arbre).
+ * 'borne_exacte' vaut faux si la borne a été calculée sur le graphe restreint.
+ */
+ListesCandidats* calculer_candidats_alpha(const InstanceTSP* instance, FonctionDistance dist_func,
+                                          int k, double* borne_inferieure, bool* borne_exacte);
+
+#endif
@@ -0,0 +1,239 @@
+/**
+ * cache_instances.c
+ * Cache LRU des instances préparées, plafonné en mémoire (mode serveur)
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#include "cache_instances.h"
+#include "parser.h"
+#include "candidats.h"
+#include "methodes.h"
+
+struct EntreeCache {
+    char* fichier;
+    InstanceTSP* instance;          // NULL pendant le chargement
+    FonctionDistance dist_func;
+    size_t memoire;
+    struct timespec modification;   // Fichier au moment de la lecture
+    off_t taille_fichier;
+    int utilisateurs;               // Réservations en cours (cache_prendre sans cache_rendre)
+    bool chargement;                // Lecture en cours par un thread, les autres attendent
+    bool retiree;                   // Hors de la liste : libérée au dernier cache_rendre
+    struct EntreeCache* precedente; // Liste de la plus récemment utilisée à la plus ancienne
+    struct EntreeCache* suivante;
+};
+
+struct CacheInstances {
+    size_t memoire_max;
+    bool avec_alpha;
+    bool renumeroter_hilbert;
+    EntreeCache* premiere;          // Plus récemment utilisée
+    EntreeCache* derniere;          // Moins récemment utilisée
+    StatistiquesCache statistiques;
+    pthread_mutex_t verrou;
+    pthread_cond_t charge;          // Signalé à la fin de chaque chargement
+};
+
+size_t memoire_instance(const InstanceTSP* instance) {
+    size_t n = (size_t)instance->dimension;
+    size_t memoire = sizeof(InstanceTSP);
+    if (instance->projection) {
+        memoire += instance->taille_projection;
+        if (instance->matrice_existe) memoire += n * sizeof(double*);
+        return memoire;
+    }
+    memoire += n * sizeof(Ville);
+    if (instance->matrice_existe) {
+        memoire += n * sizeof(double*) + n * (n - 1) / 2 * sizeof(double);
+    }
+    if (instance->candidats) {
+        memoire += n * (size_t)instance->candidats->k * sizeof(int);
+    }
+    return memoire;
+}
+
+CacheInstances* creer_cache_instances(size_t memoire_max, bool avec_alpha, bool renumeroter_hilbert) {
+    CacheInstances* cache = (CacheInstances*)calloc(1, sizeof(CacheInstances));
+    if (!cache) return NULL;
+    cache->memoire_max = memoire_max;
+    cache->avec_alpha = avec_alpha;
+    cache->renumeroter_hilbert = renumeroter_hilbert;
+    pthread_mutex_init(&cache->verrou, NULL);
+    pthread_cond_init(&cache->charge, NULL);
+    return cache;
+}
+
+static void liberer_entree(EntreeCache* entree) {
+    liberer_instance(entree->instance);
+    free(entree->fichier);
+    free(entree);
+}
+
+void liberer_cache_instances(CacheInstances* cache) {
+    if (!cache) return;
+    EntreeCache* entree = cache->premiere;
+    while (entree) {
+        EntreeCache* suivante = entree->suivante;
+        liberer_entree(entree);
+        entree = suivante;
+    }
+    pthread_cond_destroy(&cache->charge);
+    pthread_mutex_destroy(&cache->verrou);
+    free(cache);
+}
+
+// Opérations sur la liste, verrou tenu
+static void detacher(CacheInstances* cache, EntreeCache* entree) {
+    if (entree->precedente) entree->precedente->suivante = entree->suivante;
+    else cache->premiere = entree->suivante;
+    if (entree->suivante) entree->suivante->precedente = entree->precedente;
+    else cache->derniere = entree->precedente;
+    entree->precedente = entree->suivante = NULL;
+}
+
+static void placer_en_tete(CacheInstances* cache, EntreeCache* entree) {
+    entree->precedente = NULL;
+    entree->suivante = cache->premiere;
+    if (cache->premiere) cache->premiere->precedente = entree;
+    else cache->derniere = entree;
+    cache->premiere = entree;
+}
+
+// Retire l'entrée du cache ; libérée tout de suite si personne ne l'utilise
+static void retirer(CacheInstances* cache, EntreeCache* entree) {
+    detacher(cache, entree);
+    cache->statistiques.memoire -= entree->memoire;
+    cache->statistiques.nb_instances--;
+    entree->retiree = true;
+    if (entree->utilisateurs == 0) liberer_entree(entree);
+}
+
+// Libère les moins récemment utilisées (non réservées) tant que le plafond est dépassé
+static void respecter_plafond(CacheInstances* cache) {
+    EntreeCache* entree = cache->derniere;
+    while (entree && cache->statistiques.memoire > cache->memoire_max) {
+        EntreeCache* precedente = entree->precedente;
+        if (entree->utilisateurs == 0 && !entree->chargement) {
+            retirer(cache, entree);
+            cache->statistiques.evictions++;
+        }
+        entree = precedente;
+    }
+}
+
+static EntreeCache* chercher(CacheInstances* cache, const char* fichier) {
+    for (EntreeCache* entree = cache->premiere; entree; entree = entree->suivante) {
+        if (strcmp(entree->fichier, fichier) == 0) return entree;
+    }
+    return NULL;
+}
+
+static bool meme_fichier(const EntreeCache* entree, const struct stat* etat) {
+    return entree->taille_fichier == etat->st_size
+        && entree->modification.tv_sec == etat->st_mtim.tv_sec
+        && entree->modification.tv_nsec == etat->st_mtim.tv_nsec;
+}
+
+EntreeCache* cache_prendre(CacheInstances* cache, const char* fichier, bool* trouvee) {
+    struct stat etat;
+    if (stat(fichier, &etat) != 0) {
+        perror("Erreur ouverture du fichier");
+        return NULL;
+    }
+
+    pthread_mutex_lock(&cache->verrou);
+    EntreeCache* entree;
+    for (;;) {
+        entree = chercher(cache, fichier);
+        if (entree && entree->chargement) {
+            pthread_cond_wait(&cache->charge, &cache->verrou);
+            continue;
+        }
+        if (entree && !meme_fichier(entree, &etat)) {
+            retirer(cache, entree);
+            entree = NULL;
+        }
+        break;
+    }
+    if (entree) {
+        detacher(cache, entree);
+        placer_en_tete(cache, entree);
+        entree->utilisateurs++;
+        cache->statistiques.succes++;
+        pthread_mutex_unlock(&cache->verrou);
+        if (trouvee) *trouvee = true;
+        return entree;
+    }
+
+    // Entrée réservée pendant la lecture : les autres demandes du même fichier l'attendent
+    entree = (EntreeCache*)calloc(1, sizeof(EntreeCache));
+    char* copie = strdup(fichier);
+    if (!entree || !copie) {
+        pthread_mutex_unlock(&cache->verrou);
+        free(entree);
+        free(copie);
+        return NULL;
+    }
+    entree->fichier = copie;
+    entree->modification = etat.st_mtim;
+    entree->taille_fichier = etat.st_size;
+    entree->chargement = true;
+    entree->utilisateurs = 1;
+    placer_en_tete(cache, entree);
+    cache->statistiques.nb_instances++;
+    pthread_mutex_unlock(&cache->verrou);
+
+    InstanceTSP* instance = lire_fichier_tsplib(fichier);
+    if (instance && !preparer_instance(instance, cache->avec_alpha, cache->renumeroter_hilbert, false,
+                                       &entree->dist_func)) {
+        liberer_instance(instance);
+        instance = NULL;
+    }
+
+    pthread_mutex_lock(&cache->verrou);
+    entree->chargement = false;
+    entree->instance = instance;
+    if (instance) {
+        entree->memoire = memoire_instance(instance);
+        cache->statistiques.memoire += entree->memoire;
+        cache->statistiques.chargements++;
+        respecter_plafond(cache);
+    } else {
+        entree->utilisateurs = 0;
+        retirer(cache, entree);
+        entree = NULL;
+    }
+    pthread_cond_broadcast(&cache->charge);
+    pthread_mutex_unlock(&cache->verrou);
+    if (trouvee) *trouvee = false;
+    return entree;
+}
+
+void cache_rendre(CacheInstances* cache, EntreeCache* entree) {
+    if (!entree) return;
+    pthread_mutex_lock(&cache->verrou);
+    entree->utilisateurs--;
+    if (entree->utilisateurs == 0) {
+        if (entree->retiree) liberer_entree(entree);
+        else respecter_plafond(cache);
+    }
+    pthread_mutex_unlock(&cache->verrou);
+}
+
+const InstanceTSP* entree_cache_instance(const EntreeCache* entree) {
+    return entree->instance;
+}
+
+FonctionDistance entree_cache_distance(const EntreeCache* entree) {
+    return entree->dist_func;
+}
+
+void cache_statistiques(CacheInstances* cache, StatistiquesCache* statistiques) {
+    pthread_mutex_lock(&cache->verrou);
+    *statistiques = cache->statistiques;
+    pthread_mutex_unlock(&cache->verrou);
+}
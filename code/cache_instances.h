@@ -0,0 +1,42 @@
+#ifndef CACHE_INSTANCES_H
+#define CACHE_INSTANCES_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "tsp.h"
+
+/*  Cache des instances préparées (lecture, matrice, candidats) du mode serveur,
+    partagé par les threads. Les instances les moins récemment utilisées sont
+    libérées dès que la mémoire estimée dépasse le plafond ; une instance en cours
+    d'utilisation n'est jamais libérée. Un fichier modifié depuis son chargement
+    est relu. */
+
+typedef struct CacheInstances CacheInstances;
+typedef struct EntreeCache EntreeCache;
+
+typedef struct {
+    long long succes;           // Instances trouvées dans le cache
+    long long chargements;      // Instances lues
+    long long evictions;        // Instances libérées pour respecter le plafond
+    size_t memoire;             // Mémoire estimée des instances présentes (octets)
+    int nb_instances;
+} StatistiquesCache;
+
+// 'memoire_max' en octets ; les instances sont préparées par preparer_instance (methodes.h)
+CacheInstances* creer_cache_instances(size_t memoire_max, bool avec_alpha, bool renumeroter_hilbert);
+void liberer_cache_instances(CacheInstances* cache);
+
+// Instance du fichier, lue si besoin ; réservée jusqu'à cache_rendre. NULL si la
+// lecture a échoué. 'trouvee' (si non NULL) : vrai si elle était déjà dans le cache.
+EntreeCache* cache_prendre(CacheInstances* cache, const char* fichier, bool* trouvee);
+void cache_rendre(CacheInstances* cache, EntreeCache* entree);
+
+const InstanceTSP* entree_cache_instance(const EntreeCache* entree);
+FonctionDistance entree_cache_distance(const EntreeCache* entree);
+
+// Mémoire occupée par une instance (villes, matrice, candidats ou projection)
+size_t memoire_instance(const InstanceTSP* instance);
+
+void cache_statistiques(CacheInstances* cache, StatistiquesCache* statistiques);
+
+#endif
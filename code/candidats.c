@@ -0,0 +1,195 @@
+/**
+ * candidats.c
+ * Listes des k plus proches voisins de chaque ville
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+
+#include "candidats.h"
+#include "distance.h"
+#include "matrice.h"
+#include "grille.h"
+
+// Parcours complet en O(n) pour une ville (distances non planaires)
+static void k_plus_proches_complet(const InstanceTSP* instance, FonctionDistance dist_func,
+                                   int v, int k, int* voisins, double* distances) {
+    int n = instance->dimension;
+    int nb = 0;
+    for (int w = 0; w < n; w++) {
+        if (w == v) continue;
+        double dist = distance_villes(instance, dist_func, v, w);
+        if (nb == k && dist >= distances[k - 1]) continue;
+
+        int pos = (nb < k) ? nb++ : k - 1;
+        while (pos > 0 && distances[pos - 1] > dist) {
+            distances[pos] = distances[pos - 1];
+            voisins[pos] = voisins[pos - 1];
+            pos--;
+        }
+        distances[pos] = dist;
+        voisins[pos] = w;
+    }
+}
+
+ListesCandidats* calculer_candidats(const InstanceTSP* instance, FonctionDistance dist_func, int k) {
+    int n = instance->dimension;
+    if (k > n - 1) k = n - 1;
+    if (k < 1) return NULL;
+
+    ListesCandidats* candidats = (ListesCandidats*)malloc(sizeof(ListesCandidats));
+    double* distances = (double*)malloc(k * sizeof(double));
+    if (!candidats || !distances) {
+        free(candidats);
+        free(distances);
+        return NULL;
+    }
+    candidats->n = n;
+    candidats->k = k;
+    candidats->triee_par_distance = true;
+    candidats->voisins = (int*)malloc((size_t)n * k * sizeof(int));
+    if (!candidats->voisins) {
+        free(candidats);
+        free(distances);
+        return NULL;
+    }
+
+    GrilleVilles* grille = NULL;
+    if (distance_planaire(instance->type_distance) && instance->villes) {
+        grille = creer_grille(instance, 2);
+    }
+
+    for (int i = 0; i < n; i++) {
+        int* voisins = candidats->voisins + (size_t)i * k;
+        if (grille) {
+            grille_k_plus_proches(grille, instance, dist_func, i, k, voisins, distances);
+        } else {
+            k_plus_proches_complet(instance, dist_func, i, k, voisins, distances);
+        }
+    }
+
+    liberer_grille(grille);
+    free(distances);
+    return candidats;
+}
+
+ListesCandidats* calculer_candidats_quadrants(const InstanceTSP* instance, FonctionDistance dist_func,
+                                              int k, int par_quadrant) {
+    int n = instance->dimension;
+    if (!distance_planaire(instance->type_distance) || !instance->villes) {
+        return calculer_candidats(instance, dist_func, k + 4 * par_quadrant);
+    }
+    ListesCandidats* proches = calculer_candidats(instance, dist_func, k);
+    if (!proches) return NULL;
+    k = proches->k;
+
+    int largeur = k + 4 * par_quadrant;
+    ListesCandidats* candidats = (ListesCandidats*)malloc(sizeof(ListesCandidats));
+    int* voisins_quadrant = (int*)malloc(par_quadrant * sizeof(int));
+    double* distances = (double*)malloc(par_quadrant * sizeof(double));
+    GrilleVilles* grille = creer_grille(instance, 2);
+    if (candidats) candidats->voisins = (int*)malloc((size_t)n * largeur * sizeof(int));
+    if (!candidats || !candidats->voisins || !voisins_quadrant || !distances || !grille) {
+        if (candidats) free(candidats->voisins);
+        free(candidats);
+        free(voisins_quadrant);
+        free(distances);
+        liberer_grille(grille);
+        liberer_candidats(proches);
+        return NULL;
+    }
+    candidats->n = n;
+    candidats->k = largeur;
+    candidats->triee_par_distance = false;
+
+    for (int i = 0; i < n; i++) {
+        int* ligne = candidats->voisins + (size_t)i * largeur;
+        memcpy(ligne, proches->voisins + (size_t)i * k, k * sizeof(int));
+        int nb = k;
+        for (int q = 0; q < 4; q++) {
+            int trouves = grille_k_plus_proches_quadrant(grille, instance, dist_func, i, par_quadrant, q,
+                                                         voisins_quadrant, distances);
+            for (int t = 0; t < trouves; t++) ligne[nb++] = voisins_quadrant[t];
+        }
+        // Quadrants peu peuplés : les places libres répètent le plus proche voisin
+        while (nb < largeur) ligne[nb++] = ligne[0];
+    }
+
+    free(voisins_quadrant);
+    free(distances);
+    liberer_grille(grille);
+    liberer_candidats(proches);
+    return candidats;
+}
+
+void liberer_candidats(ListesCandidats* candidats) {
+    if (candidats) {
+        free(candidats->voisins);
+        free(candidats);
+    }
+}
+
+ListesCandidats* copier_candidats(const ListesCandidats* source) {
+    if (!source) return NULL;
+    ListesCandidats* copie = (ListesCandidats*)malloc(sizeof(ListesCandidats));
+    if (!copie) return NULL;
+    copie->n = source->n;
+    copie->k = source->k;
+    copie->triee_par_distance = source->triee_par_distance;
+    copie->voisins = (int*)malloc((size_t)source->n * source->k * sizeof(int));
+    if (!copie->voisins) {
+        free(copie);
+        return NULL;
+    }
+    memcpy(copie->voisins, source->voisins, (size_t)source->n * source->k * sizeof(int));
+    return copie;
+}
+
+ListesCandidats* candidats_recherche_locale(const InstanceTSP* instance, FonctionDistance dist_func) {
+    if (instance->candidats) return copier_candidats(instance->candidats);
+    return calculer_candidats(instance, dist_func, NB_CANDIDATS_DEFAUT);
+}
+
+GrapheCandidats* creer_graphe_candidats(const ListesCandidats* candidats) {
+    int n = candidats->n;
+    int k = candidats->k;
+    GrapheCandidats* graphe = (GrapheCandidats*)malloc(sizeof(GrapheCandidats));
+    if (!graphe) return NULL;
+    graphe->n = n;
+    graphe->debut = (int*)calloc(n + 1, sizeof(int));
+    graphe->voisins = (int*)malloc(2 * (size_t)n * k * sizeof(int));
+    int* remplissage = (int*)calloc(n, sizeof(int));
+    if (!graphe->debut || !graphe->voisins || !remplissage) {
+        free(remplissage);
+        liberer_graphe_candidats(graphe);
+        return NULL;
+    }
+
+    for (int i = 0; i < n; i++) {
+        for (int r = 0; r < k; r++) {
+            int j = candidats->voisins[(size_t)i * k + r];
+            graphe->debut[i + 1]++;
+            graphe->debut[j + 1]++;
+        }
+    }
+    for (int i = 0; i < n; i++) graphe->debut[i + 1] += graphe->debut[i];
+    for (int i = 0; i < n; i++) {
+        for (int r = 0; r < k; r++) {
+            int j = candidats->voisins[(size_t)i * k + r];
+            graphe->voisins[graphe->debut[i] + remplissage[i]++] = j;
+            graphe->voisins[graphe->debut[j] + remplissage[j]++] = i;
+        }
+    }
+    free(remplissage);
+    return graphe;
+}
+
+void liberer_graphe_candidats(GrapheCandidats* graphe) {
+    if (graphe) {
+        free(graphe->debut);
+        free(graphe->voisins);
+        free(graphe);
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef CANDIDATS_H
+#define CANDIDATS_H
+
+#include "tsp.h"
+
+#define NB_CANDIDATS_DEFAUT 10
+
+// Listes de candidats : pour chaque ville, ses k plus proches voisins
+typedef struct ListesCandidats {
+    int n;              // Nombre de villes
+    int k;              // Nombre de candidats par ville
+    int* voisins;       // voisins[i * k + r] : r-ième candidat de la ville i (0-indexés)
+    bool triee_par_distance;    // Listes triées par distance croissante : arrêt anticipé possible
+} ListesCandidats;
+
+// Calcule les k plus proches voisins de chaque ville, triés par distance croissante.
+// Utilise la grille pour EUCL_2D/ATT, un parcours complet sinon.
+ListesCandidats* calculer_candidats(const InstanceTSP* instance, FonctionDistance dist_func, int k);
+
+// k plus proches voisins complétés par les 'par_quadrant' plus proches de chacun des
+// quatre quadrants (instances à grappes). Chaque liste compte k + 4 * par_quadrant
+// entrées, éventuellement répétées et non triées ; k + 4 * par_quadrant plus proches
+// voisins si la distance n'est pas planaire.
+ListesCandidats* calculer_candidats_quadrants(const InstanceTSP* instance, FonctionDistance dist_func,
+                                              int k, int par_quadrant);
+
+void liberer_candidats(ListesCandidats* candidats);
+
+ListesCandidats* copier_candidats(const ListesCandidats* source);
+
+// Candidats des recherches locales : copie des candidats portés par l'instance
+// (alpha-nearness, option -a) s'il y en a, k plus proches voisins sinon
+ListesCandidats* candidats_recherche_locale(const InstanceTSP* instance, FonctionDistance dist_func);
+
+// Graphe non orienté des candidats au format CSR : j est voisin de i si j est
+// candidat de i ou i candidat de j (une arête peut apparaître deux fois)
+typedef struct {
+    int n;
+    int* debut;         // Voisins de i : voisins[debut[i] .. debut[i + 1] - 1]
+    int* voisins;
+} GrapheCandidats;
+
+GrapheCandidats* creer_graphe_candidats(const ListesCandidats* candidats);
+
+void liberer_graphe_candidats(GrapheCandidats* graphe);
+
+#endif
@@ -0,0 +1,147 @@
+/**
+ * checkpoint.c
+ * Points de reprise binaires des calculs longs (force brute, algorithme génétique)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <signal.h>
+
+#include "checkpoint.h"
+#include "chrono.h"
+
+#define SIGNATURE_CHECKPOINT "TSPREPRI"
+#define VERSION_CHECKPOINT 1
+
+typedef struct {
+    char signature[8];
+    uint32_t version;
+    uint32_t type;
+    int32_t dimension;
+    char nom[NOM_MAX];
+} EnTeteCheckpoint;
+
+static volatile sig_atomic_t arret_demande = 0;
+
+void checkpoint_sigterm(int sig) {
+    (void)sig;
+    arret_demande = 1;
+}
+
+void checkpoint_installer_sigterm(void) {
+    struct sigaction action;
+    action.sa_handler = checkpoint_sigterm;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = 0;
+    sigaction(SIGTERM, &action, NULL);
+}
+
+bool checkpoint_arret_demande(void) {
+    return arret_demande != 0;
+}
+
+void minuterie_checkpoint_initialiser(MinuterieCheckpoint* minuterie, const ParamsCheckpoint* params) {
+    minuterie->params = params;
+    minuterie->prochaine = (params && params->fichier) ? temps_mur() + params->intervalle : 0.0;
+}
+
+bool checkpoint_a_ecrire(MinuterieCheckpoint* minuterie) {
+    if (!minuterie->params || !minuterie->params->fichier) return false;
+    if (arret_demande) return true;
+    double maintenant = temps_mur();
+    if (maintenant < minuterie->prochaine) return false;
+    minuterie->prochaine = maintenant + minuterie->params->intervalle;
+    return true;
+}
+
+static void nom_temporaire(char* tampon, size_t taille, const char* fichier) {
+    snprintf(tampon, taille, "%s.tmp", fichier);
+}
+
+FILE* checkpoint_ouvrir_ecriture(const char* fichier, TypeCheckpoint type, const InstanceTSP* instance) {
+    char temporaire[4096];
+    nom_temporaire(temporaire, sizeof(temporaire), fichier);
+    FILE* f = fopen(temporaire, "wb");
+    if (!f) {
+        perror("Erreur écriture point de reprise");
+        return NULL;
+    }
+
+    EnTeteCheckpoint entete;
+    memset(&entete, 0, sizeof(entete));
+    memcpy(entete.signature, SIGNATURE_CHECKPOINT, sizeof(entete.signature));
+    entete.version = VERSION_CHECKPOINT;
+    entete.type = (uint32_t)type;
+    entete.dimension = instance->dimension;
+    snprintf(entete.nom, sizeof(entete.nom), "%s", instance->nom);
+    if (!checkpoint_ecrire(f, &entete, sizeof(entete))) {
+        fclose(f);
+        remove(temporaire);
+        return NULL;
+    }
+    return f;
+}
+
+bool checkpoint_terminer_ecriture(FILE* f, const char* fichier) {
+    char temporaire[4096];
+    nom_temporaire(temporaire, sizeof(temporaire), fichier);
+    bool ok = fflush(f) == 0 && !ferror(f);
+    ok = (fclose(f) == 0) && ok;
+    if (ok && rename(temporaire, fichier) != 0) {
+        perror("Erreur écriture point de reprise");
+        ok = false;
+    }
+    if (!ok) remove(temporaire);
+    return ok;
+}
+
+FILE* checkpoint_ouvrir_lecture(const char* fichier, TypeCheckpoint type, const InstanceTSP* instance) {
+    FILE* f = fopen(fichier, "rb");
+    if (!f) {
+        perror("Erreur ouverture point de reprise");
+        return NULL;
+    }
+
+    EnTeteCheckpoint entete;
+    const char* erreur = NULL;
+    if (!checkpoint_lire(f, &entete, sizeof(entete))
+        || memcmp(entete.signature, SIGNATURE_CHECKPOINT, sizeof(entete.signature)) != 0) {
+        erreur = "fichier invalide";
+    } else if (entete.version != VERSION_CHECKPOINT) {
+        erreur = "version non supportée";
+    } else if (entete.type != (uint32_t)type) {
+        erreur = "calcul différent";
+    } else if (entete.dimension != instance->dimension
+               || strncmp(entete.nom, instance->nom, NOM_MAX) != 0) {
+        erreur = "instance différente";
+    }
+    if (erreur) {
+        fprintf(stderr, "Erreur: point de reprise '%s' : %s.\n", fichier, erreur);
+        fclose(f);
+        return NULL;
+    }
+    return f;
+}
+
+bool checkpoint_ecrire(FILE* f, const void* donnees, size_t taille) {
+    return fwrite(donnees, 1, taille, f) == taille;
+}
+
+bool checkpoint_lire(FILE* f, void* donnees, size_t taille) {
+    return fread(donnees, 1, taille, f) == taille;
+}
+
+bool checkpoint_permutation_valide(const int* villes, int taille, int premiere) {
+    bool* vue = calloc(taille > 0 ? taille : 1, sizeof(bool));
+    if (!vue) return false;
+    bool ok = true;
+    for (int i = 0; ok && i < taille; i++) {
+        int indice = villes[i] - premiere;
+        ok = indice >= 0 && indice < taille && !vue[indice];
+        if (ok) vue[indice] = true;
+    }
+    free(vue);
+    return ok;
+}
@@ -0,0 +1,59 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "tsp.h"
+
+// Secondes entre deux points de reprise si --checkpoint-interval n'est pas donné
+#define CHECKPOINT_INTERVALLE_DEFAUT 60.0
+
+// Calculs longs pouvant être repris
+typedef enum {
+    CHECKPOINT_FORCE_BRUTE = 1,
+    CHECKPOINT_GA = 2
+} TypeCheckpoint;
+
+typedef struct {
+    const char* fichier;        // Point de reprise à écrire (NULL : aucun)
+    double intervalle;          // Secondes entre deux écritures
+    const char* reprise;        // Point de reprise à relire au démarrage (NULL : aucun)
+} ParamsCheckpoint;
+
+// Dates des écritures périodiques
+typedef struct {
+    const ParamsCheckpoint* params;
+    double prochaine;
+} MinuterieCheckpoint;
+
+void minuterie_checkpoint_initialiser(MinuterieCheckpoint* minuterie, const ParamsCheckpoint* params);
+
+// Vrai s'il faut écrire un point de reprise : intervalle écoulé ou SIGTERM reçu
+// (toujours faux sans fichier de point de reprise)
+bool checkpoint_a_ecrire(MinuterieCheckpoint* minuterie);
+
+// Gestionnaire de SIGTERM : le calcul écrit un point de reprise puis s'arrête
+void checkpoint_sigterm(int sig);
+void checkpoint_installer_sigterm(void);
+bool checkpoint_arret_demande(void);
+
+/**
+ * Format : en-tête (signature, version, type, dimension et nom de l'instance)
+ * suivi des données propres au calcul, en binaire natif. L'écriture se fait
+ * dans "<fichier>.tmp", renommé à la fin : le point de reprise précédent reste
+ * valide si le programme est tué pendant l'écriture.
+ */
+FILE* checkpoint_ouvrir_ecriture(const char* fichier, TypeCheckpoint type, const InstanceTSP* instance);
+bool checkpoint_terminer_ecriture(FILE* f, const char* fichier);
+
+// Ouvre un point de reprise et vérifie qu'il correspond au calcul et à l'instance
+FILE* checkpoint_ouvrir_lecture(const char* fichier, TypeCheckpoint type, const InstanceTSP* instance);
+
+// Blocs de données ; faux en cas d'erreur d'entrée/sortie
+bool checkpoint_ecrire(FILE* f, const void* donnees, size_t taille);
+bool checkpoint_lire(FILE* f, void* donnees, size_t taille);
+
+// Vrai si villes[0..taille-1] est une permutation de premiere..premiere+taille-1
+bool checkpoint_permutation_valide(const int* villes, int taille, int premiere);
+
+#endif
@@ -0,0 +1,28 @@
+#include <time.h>
+
+#include "chrono.h"
+
+// Date limite du thread (temps_mur), 0 : aucune
+static __thread double echeance = 0.0;
+
+double temps_mur(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+void echeance_fixer(double secondes) {
+    echeance = secondes > 0.0 ? temps_mur() + secondes : 0.0;
+}
+
+double echeance_obtenir(void) {
+    return echeance;
+}
+
+void echeance_definir(double instant) {
+    echeance = instant;
+}
+
+bool echeance_atteinte(void) {
+    return echeance > 0.0 && temps_mur() >= echeance;
+}
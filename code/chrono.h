@@ -0,0 +1,23 @@
+#ifndef CHRONO_H
+#define CHRONO_H
+
+#include <stdbool.h>
+
+// Temps écoulé (horloge monotone), en secondes. Contrairement à clock(),
+// ne cumule pas le temps CPU des différents threads.
+double temps_mur(void);
+
+// Échéance du thread appelant, dans 'secondes' secondes (<= 0 : aucune).
+// Chaque thread a sa propre échéance : un thread de travail reprend celle
+// de son créateur avec echeance_obtenir / echeance_definir.
+void echeance_fixer(double secondes);
+
+// Échéance absolue (date temps_mur), 0 si aucune
+double echeance_obtenir(void);
+void echeance_definir(double instant);
+
+// Vrai si l'échéance du thread est dépassée. Sans échéance, ne lit pas l'horloge ;
+// sinon un appel coûte une lecture de l'horloge monotone (quelques dizaines de ns).
+bool echeance_atteinte(void);
+
+#endif
@@ -0,0 +1,365 @@
+/**
+ * decomposition.c
+ * Découpage en grappes, résolution parallèle des grappes, raccord et
+ * recherche locale sur les frontières
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <pthread.h>
+
+#include "decomposition.h"
+#include "heuristiques.h"
+#include "tsp_utils.h"
+#include "parser.h"
+#include "matrice.h"
+#include "candidats.h"
+#include "tournee_tableau.h"
+#include "recherche_locale.h"
+#include "ils.h"
+#include "chrono.h"
+
+typedef struct {
+    double cle;
+    int ville;
+} VilleTriee;
+
+// Grappes : villes de la grappe g dans villes[debut[g] .. debut[g + 1] - 1]
+typedef struct {
+    int nb_grappes;
+    int* debut;
+    int* villes;
+    int* grappe;            // Grappe de chaque ville
+} Partition;
+
+// Données partagées par les threads
+typedef struct {
+    const InstanceTSP* instance;
+    FonctionDistance dist_func;
+    const ParamsDecomposition* params;
+    const Partition* partition;
+    int* cycles;            // Cycle de chaque grappe, rangé comme partition->villes
+    double echeance;        // Échéance du thread appelant, reprise par chaque thread
+    int prochaine_grappe;   // Protégé par 'verrou'
+    pthread_mutex_t verrou;
+} TravailDecomposition;
+
+static int comparer_villes_triees(const void* a, const void* b) {
+    const VilleTriee* v1 = (const VilleTriee*)a;
+    const VilleTriee* v2 = (const VilleTriee*)b;
+    if (v1->cle < v2->cle) return -1;
+    if (v1->cle > v2->cle) return 1;
+    return v1->ville - v2->ville;
+}
+
+// Découpage récursif à la médiane selon l'axe le plus étendu (grille adaptative) :
+// grappes d'au plus 'taille' villes, même sur les instances de densité variable
+static void decouper(const InstanceTSP* instance, VilleTriee* tri, int* villes, int nb,
+                     int taille, Partition* partition, int* position) {
+    if (nb <= taille) {
+        int g = partition->nb_grappes++;
+        partition->debut[g] = *position;
+        for (int i = 0; i < nb; i++) {
+            partition->villes[(*position)++] = villes[i];
+            partition->grappe[villes[i]] = g;
+        }
+        return;
+    }
+
+    double x_min = DBL_MAX, x_max = -DBL_MAX, y_min = DBL_MAX, y_max = -DBL_MAX;
+    for (int i = 0; i < nb; i++) {
+        const Ville* v = &instance->villes[villes[i]];
+        if (v->x < x_min) x_min = v->x;
+        if (v->x > x_max) x_max = v->x;
+        if (v->y < y_min) y_min = v->y;
+        if (v->y > y_max) y_max = v->y;
+    }
+    bool selon_x = (x_max - x_min) >= (y_max - y_min);
+    for (int i = 0; i < nb; i++) {
+        const Ville* v = &instance->villes[villes[i]];
+        tri[i].cle = selon_x ? v->x : v->y;
+        tri[i].ville = villes[i];
+    }
+    qsort(tri, nb, sizeof(VilleTriee), comparer_villes_triees);
+    for (int i = 0; i < nb; i++) villes[i] = tri[i].ville;
+
+    int moitie = nb / 2;
+    decouper(instance, tri, villes, moitie, taille, partition, position);
+    decouper(instance, tri, villes + moitie, nb - moitie, taille, partition, position);
+}
+
+static bool partitionner(const InstanceTSP* instance, int taille, Partition* partition) {
+    int n = instance->dimension;
+    int max_grappes = 2 * ((n + taille - 1) / taille) + 1;
+    partition->nb_grappes = 0;
+    partition->debut = (int*)malloc((max_grappes + 1) * sizeof(int));
+    partition->villes = (int*)malloc(n * sizeof(int));
+    partition->grappe = (int*)malloc(n * sizeof(int));
+    int* villes = (int*)malloc(n * sizeof(int));
+    VilleTriee* tri = (VilleTriee*)malloc(n * sizeof(VilleTriee));
+    bool ok = partition->debut && partition->villes && partition->grappe && villes && tri;
+    if (ok) {
+        for (int i = 0; i < n; i++) villes[i] = i;
+        int position = 0;
+        decouper(instance, tri, villes, n, taille, partition, &position);
+        partition->debut[partition->nb_grappes] = n;
+    }
+    free(villes);
+    free(tri);
+    return ok;
+}
+
+static void liberer_partition(Partition* partition) {
+    free(partition->debut);
+    free(partition->villes);
+    free(partition->grappe);
+}
+
+// Résout une grappe sur une sous-instance dotée de sa propre matrice (bloc contigu)
+static void resoudre_grappe(TravailDecomposition* travail, int g) {
+    const Partition* partition = travail->partition;
+    const InstanceTSP* instance = travail->instance;
+    int debut = partition->debut[g];
+    int m = partition->debut[g + 1] - debut;
+    const int* villes = partition->villes + debut;
+    int* cycle = travail->cycles + debut;
+
+    if (m <= 3) {
+        memcpy(cycle, villes, m * sizeof(int));
+        return;
+    }
+
+    InstanceTSP* sous = (InstanceTSP*)calloc(1, sizeof(InstanceTSP));
+    if (sous) sous->villes = (Ville*)malloc(m * sizeof(Ville));
+    if (!sous || !sous->villes) {
+        liberer_instance(sous);
+        memcpy(cycle, villes, m * sizeof(int));
+        return;
+    }
+    snprintf(sous->nom, NOM_MAX, "%.200s.%d", instance->nom, g);
+    sous->dimension = m;
+    sous->type_distance = instance->type_distance;
+    for (int i = 0; i < m; i++) sous->villes[i] = instance->villes[villes[i]];
+    calculer_matrice_distances(sous, travail->dist_func);
+
+    Tournee* tournee = plus_proche_voisin_grille(sous, travail->dist_func);
+    if (tournee) {
+        ParamsILS params_ils;
+        params_ils_defaut(&params_ils);
+        params_ils.nb_perturbations = travail->params->nb_perturbations;
+        recherche_locale_iteree(tournee, sous, travail->dist_func, &params_ils);
+        for (int i = 0; i < m; i++) cycle[i] = villes[tournee->chemin[i] - 1];
+        liberer_tournee(tournee);
+    } else {
+        memcpy(cycle, villes, m * sizeof(int));
+    }
+    liberer_instance(sous);
+}
+
+static void* thread_decomposition(void* arg) {
+    TravailDecomposition* travail = (TravailDecomposition*)arg;
+    echeance_definir(travail->echeance);
+    while (1) {
+        pthread_mutex_lock(&travail->verrou);
+        int g = travail->prochaine_grappe++;
+        pthread_mutex_unlock(&travail->verrou);
+        if (g >= travail->partition->nb_grappes) break;
+        resoudre_grappe(travail, g);
+    }
+    return NULL;
+}
+
+// Ordre de visite des grappes : plus proche voisin + 2-opt sur leurs barycentres
+static int* ordonner_grappes(const InstanceTSP* instance, FonctionDistance dist_func,
+                             const Partition* partition, Ville* barycentres) {
+    int nb = partition->nb_grappes;
+    for (int g = 0; g < nb; g++) {
+        double sx = 0.0, sy = 0.0;
+        for (int p = partition->debut[g]; p < partition->debut[g + 1]; p++) {
+            sx += instance->villes[partition->villes[p]].x;
+            sy += instance->villes[partition->villes[p]].y;
+        }
+        int m = partition->debut[g + 1] - partition->debut[g];
+        barycentres[g].numero = g + 1;
+        barycentres[g].x = sx / m;
+        barycentres[g].y = sy / m;
+    }
+
+    int* ordre = (int*)malloc(nb * sizeof(int));
+    if (!ordre) return NULL;
+    InstanceTSP centres;
+    memset(&centres, 0, sizeof(InstanceTSP));
+    centres.dimension = nb;
+    centres.type_distance = instance->type_distance;
+    centres.villes = barycentres;
+    Tournee* tournee = nb > 1 ? plus_proche_voisin(&centres, dist_func) : NULL;
+    if (tournee) {
+        deux_opt(tournee, &centres, dist_func);
+        for (int g = 0; g < nb; g++) ordre[g] = tournee->chemin[g] - 1;
+        liberer_tournee(tournee);
+    } else {
+        for (int g = 0; g < nb; g++) ordre[g] = g;
+    }
+    return ordre;
+}
+
+// Ville de la grappe g la plus proche du point p
+static int plus_proche_dans_grappe(const InstanceTSP* instance, FonctionDistance dist_func,
+                                   const Partition* partition, int g, const Ville* p) {
+    int meilleure = partition->villes[partition->debut[g]];
+    double distance_min = DBL_MAX;
+    for (int q = partition->debut[g]; q < partition->debut[g + 1]; q++) {
+        int v = partition->villes[q];
+        double d = dist_func(p, &instance->villes[v]);
+        if (d < distance_min) {
+            distance_min = d;
+            meilleure = v;
+        }
+    }
+    return meilleure;
+}
+
+/**
+ * Raccord : chaque cycle est ouvert à côté de sa ville d'entrée (la plus proche de
+ * la sortie de la grappe précédente), dans le sens dont la sortie est la plus
+ * proche du barycentre de la grappe suivante. Les entrées et sorties sont marquées.
+ * Retourne faux si l'allocation échoue (tournée inchangée).
+ */
+static bool raccorder(const InstanceTSP* instance, FonctionDistance dist_func,
+                      const Partition* partition, const int* cycles, const int* ordre,
+                      const Ville* barycentres, Tournee* tournee, bool* frontiere) {
+    int nb = partition->nb_grappes;
+    int* position_cycle = (int*)malloc(instance->dimension * sizeof(int));
+    if (!position_cycle) return false;
+    for (int p = 0; p < instance->dimension; p++) position_cycle[cycles[p]] = p;
+
+    int k = 0;
+    int entree = plus_proche_dans_grappe(instance, dist_func, partition, ordre[0],
+                                         &barycentres[ordre[nb - 1]]);
+    for (int t = 0; t < nb; t++) {
+        int g = ordre[t];
+        int debut = partition->debut[g];
+        int m = partition->debut[g + 1] - debut;
+        int pos = position_cycle[entree] - debut;
+        const Ville* suivant = &barycentres[ordre[(t + 1) % nb]];
+
+        // Sortie : prédécesseur (parcours direct) ou successeur (parcours inverse) de l'entrée
+        int predecesseur = cycles[debut + (pos - 1 + m) % m];
+        int successeur = cycles[debut + (pos + 1) % m];
+        bool direct = dist_func(&instance->villes[predecesseur], suivant)
+                   <= dist_func(&instance->villes[successeur], suivant);
+        for (int i = 0; i < m; i++) {
+            int p = direct ? (pos + i) % m : (pos - i + m) % m;
+            tournee->chemin[k++] = cycles[debut + p] + 1;
+        }
+        int sortie = direct ? predecesseur : successeur;
+        frontiere[entree] = true;
+        frontiere[sortie] = true;
+
+        if (t + 1 < nb) {
+            entree = plus_proche_dans_grappe(instance, dist_func, partition, ordre[t + 1],
+                                             &instance->villes[sortie]);
+        }
+    }
+    free(position_cycle);
+    return true;
+}
+
+void params_decomposition_defaut(ParamsDecomposition* params) {
+    params->taille_grappe = DECOMP_TAILLE_GRAPPE;
+    params->nb_perturbations = 0;
+    params->nb_threads = 1;
+}
+
+Tournee* decomposition(const InstanceTSP* instance, FonctionDistance dist_func,
+                       const ParamsDecomposition* params) {
+    int n = instance->dimension;
+    int taille = params->taille_grappe > 8 ? params->taille_grappe : 8;
+
+    Partition partition;
+    if (!partitionner(instance, taille, &partition)) {
+        liberer_partition(&partition);
+        return NULL;
+    }
+    int nb = partition.nb_grappes;
+
+    // 1-2. Résolution des grappes en parallèle
+    TravailDecomposition travail;
+    travail.instance = instance;
+    travail.dist_func = dist_func;
+    travail.params = params;
+    travail.partition = &partition;
+    travail.cycles = (int*)malloc(n * sizeof(int));
+    travail.prochaine_grappe = 0;
+    travail.echeance = echeance_obtenir();
+    pthread_mutex_init(&travail.verrou, NULL);
+
+    int nb_threads = params->nb_threads < 1 ? 1 : params->nb_threads;
+    if (nb_threads > nb) nb_threads = nb;
+    pthread_t* threads = (pthread_t*)malloc(nb_threads * sizeof(pthread_t));
+    Ville* barycentres = (Ville*)malloc(nb * sizeof(Ville));
+    Tournee* tournee = creer_tournee(n);
+    bool* frontiere = (bool*)calloc(n, sizeof(bool));
+    if (!travail.cycles || !threads || !barycentres || !tournee || !frontiere) {
+        free(travail.cycles);
+        free(threads);
+        free(barycentres);
+        free(frontiere);
+        liberer_tournee(tournee);
+        liberer_partition(&partition);
+        pthread_mutex_destroy(&travail.verrou);
+        return NULL;
+    }
+
+    // Les grappes sont distribuées à la demande : si un thread ne peut être créé,
+    // les threads déjà lancés (et celui-ci) traitent toutes les grappes
+    int nb_lances = 1;
+    while (nb_lances < nb_threads
+           && pthread_create(&threads[nb_lances], NULL, thread_decomposition, &travail) == 0) {
+        nb_lances++;
+    }
+    thread_decomposition(&travail);
+    for (int t = 1; t < nb_lances; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    // 3-4. Ordre des grappes et raccord
+    int* ordre = ordonner_grappes(instance, dist_func, &partition, barycentres);
+    if (!ordre || !raccorder(instance, dist_func, &partition, travail.cycles, ordre, barycentres,
+                             tournee, frontiere)) {
+        for (int i = 0; i < n; i++) tournee->chemin[i] = travail.cycles[i] + 1;
+    }
+
+    // 5. 2-opt/Or-opt sur les villes des frontières : raccords et villes dont un
+    //    candidat appartient à une autre grappe
+    ListesCandidats* candidats = candidats_recherche_locale(instance, dist_func);
+    TourneeTableau* tableau = candidats ? creer_tournee_tableau(tournee) : NULL;
+    RechercheLocale* recherche = tableau
+                               ? creer_recherche_locale(instance, dist_func, candidats, tableau) : NULL;
+    if (recherche) {
+        for (int v = 0; v < n; v++) {
+            for (int r = 0; r < candidats->k && !frontiere[v]; r++) {
+                int w = candidats->voisins[(size_t)v * candidats->k + r];
+                if (partition.grappe[w] != partition.grappe[v]) frontiere[v] = true;
+            }
+            if (frontiere[v]) recherche_locale_activer(recherche, v);
+        }
+        recherche_locale_optimiser(recherche);
+        tableau_vers_tournee(tableau, tournee);
+    }
+    calculer_longueur_tournee(tournee, instance, dist_func);
+
+    liberer_recherche_locale(recherche);
+    liberer_tournee_tableau(tableau);
+    liberer_candidats(candidats);
+    free(ordre);
+    free(frontiere);
+    free(barycentres);
+    free(threads);
+    free(travail.cycles);
+    liberer_partition(&partition);
+    pthread_mutex_destroy(&travail.verrou);
+    return tournee;
+}
@@ -0,0 +1,27 @@
+#ifndef DECOMPOSITION_H
+#define DECOMPOSITION_H
+
+#include "tsp.h"
+
+// Nombre maximal de villes par grappe : la matrice d'une grappe de 1000 villes
+// occupe 4 Mo, de l'ordre d'un cache de dernier niveau
+#define DECOMP_TAILLE_GRAPPE 1000
+
+typedef struct {
+    int taille_grappe;
+    long long nb_perturbations;     // Perturbations ILS par grappe (<= 0 : taille de la grappe)
+    int nb_threads;
+} ParamsDecomposition;
+
+void params_decomposition_defaut(ParamsDecomposition* params);
+
+/**
+ * Décomposition : découpage spatial en grappes équilibrées, résolution de chaque
+ * grappe (plus proche voisin + ILS sur une sous-instance avec sa propre matrice)
+ * en parallèle, ordre des grappes par une tournée de leurs barycentres, raccord
+ * des morceaux puis 2-opt/Or-opt limité aux villes des frontières.
+ */
+Tournee* decomposition(const InstanceTSP* instance, FonctionDistance dist_func,
+                       const ParamsDecomposition* params);
+
+#endif
@@ -1,8 +1,10 @@
 #include "distance.h"
 #include "math.h"
+#include "mesures.h"
 
 // EUCL_2D : Arrondi à l'entier le plus proche
 double dist_eucl_2d(const Ville* v1, const Ville* v2) {
+    MESURES_COMPTER(COMPTEUR_DISTANCES, 1);
     double xd = v1->x - v2->x;
     double yd = v1->y - v2->y;
     return sqrt(xd*xd + yd*yd);
@@ -17,6 +19,7 @@ static double geo_to_radians(double x) {
 
 // GEO : Calcul standard TSPLIB
 double dist_geo(const Ville* v1, const Ville* v2) {
+    MESURES_COMPTER(COMPTEUR_DISTANCES, 1);
     double RRR = 6378.388;
 
     double lat1 = geo_to_radians(v1->x);
@@ -36,6 +39,7 @@ double dist_geo(const Ville* v1, const Ville* v2) {
 
 // ATT : Calcul standard TSPLIB
 double dist_att(const Ville* v1, const Ville* v2) {
+    MESURES_COMPTER(COMPTEUR_DISTANCES, 1);
     double xd = v1->x - v2->x;
     double yd = v1->y - v2->y;
     double rij = sqrt((xd*xd + yd*yd) / 10.0);
@@ -44,6 +48,13 @@ double dist_att(const Ville* v1, const Ville* v2) {
     return (tij < rij) ? (double)(tij + 1) : (double)tij;
 }
 
+// EXPLICIT : les distances sont lues dans la matrice, jamais calculées
+double dist_explicite(const Ville* v1, const Ville* v2) {
+    (void)v1;
+    (void)v2;
+    return NAN;
+}
+
 
 FonctionDistance obtenir_fonction_distance(TypeDistance type) {
     switch (type) {
@@ -53,8 +64,14 @@ FonctionDistance obtenir_fonction_distance(TypeDistance type) {
             return dist_geo;
         case DIST_ATT:
             return dist_att;
+        case DIST_EXPLICIT:
+            return dist_explicite;
         default:
             fprintf(stderr, "Erreur: Type de distance inconnu.\n");
             return NULL;
     }
+}
+
+bool distance_planaire(TypeDistance type) {
+    return type == DIST_EUCL_2D || type == DIST_ATT;
 }
\ No newline at end of file
@@ -9,7 +9,14 @@ double dist_geo(const Ville* v1, const Ville* v2);
 
 double dist_att(const Ville* v1, const Ville* v2);
 
+// Instances EXPLICIT : toutes les distances sont dans la matrice (distance_villes),
+// cette fonction n'est jamais appelée et retourne NAN
+double dist_explicite(const Ville* v1, const Ville* v2);
+
 // Retourne la fonction de distance correspondant au type donné
 FonctionDistance obtenir_fonction_distance(TypeDistance type);
 
+// true si la distance croît avec la distance euclidienne des coordonnées (EUCL_2D, ATT)
+bool distance_planaire(TypeDistance type);
+
 #endif
\ No newline at end of file
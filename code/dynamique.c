@@ -0,0 +1,445 @@
+/**
+ * dynamique.c
+ * Modifications d'instance (ajouts, retraits, déplacements de villes) et réparation locale de la tournée
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "dynamique.h"
+#include "lecteur.h"
+#include "matrice.h"
+#include "candidats.h"
+#include "recherche_locale.h"
+#include "tournee_tableau.h"
+#include "tsp_utils.h"
+#include "parser.h" // Pour liberer_instance
+
+// État des villes de l'instance d'origine
+#define VILLE_GARDEE 0
+#define VILLE_RETIREE 1
+#define VILLE_DEPLACEE 2
+
+static bool ajouter_modification(Delta* delta, int* capacite, const Modification* modification) {
+    if (delta->nb == *capacite) {
+        int nouvelle_capacite = *capacite ? 2 * *capacite : 64;
+        Modification* modifications = (Modification*)realloc(delta->modifications,
+                                                             nouvelle_capacite * sizeof(Modification));
+        if (!modifications) return false;
+        delta->modifications = modifications;
+        *capacite = nouvelle_capacite;
+    }
+    delta->modifications[delta->nb++] = *modification;
+    return true;
+}
+
+// Lit "x y" après sauter_espaces ; NULL si les coordonnées manquent
+static const char* lire_coordonnees(const char* p, const char* fin, Modification* modification) {
+    p = analyser_reel(sauter_espaces(p, fin), fin, &modification->x);
+    if (!p) return NULL;
+    return analyser_reel(sauter_espaces(p, fin), fin, &modification->y);
+}
+
+Delta* lire_fichier_delta(const char* fichier) {
+    Lecteur* lecteur = ouvrir_lecteur(fichier);
+    if (!lecteur) return NULL;
+    Delta* delta = (Delta*)calloc(1, sizeof(Delta));
+    int capacite = 0;
+    bool ok = delta != NULL;
+
+    const char* ligne;
+    const char* fin;
+    while (ok && lecteur_ligne(lecteur, &ligne, &fin)) {
+        const char* p = sauter_espaces(ligne, fin);
+        if (p == fin || *p == '#') continue;
+
+        Modification modification = { MODIFICATION_AJOUT, 0, 0.0, 0.0 };
+        char symbole = *p++;
+        long long numero = 0;
+        if (symbole == '-' || symbole == '~') {
+            modification.type = symbole == '-' ? MODIFICATION_RETRAIT : MODIFICATION_DEPLACEMENT;
+            p = analyser_entier(sauter_espaces(p, fin), fin, &numero);
+            if (p && (numero < 1 || numero > 2147483647LL)) p = NULL;
+            modification.numero = (int)numero;
+        }
+        if (p && symbole != '-') p = lire_coordonnees(p, fin, &modification);
+        if (symbole != '+' && symbole != '-' && symbole != '~') {
+            fprintf(stderr, "Erreur: %s : ligne %ld : modification '%c' inconnue (+, - ou ~).\n",
+                    fichier, lecteur->ligne, symbole);
+            ok = false;
+        } else if (!p || sauter_espaces(p, fin) != fin) {
+            fprintf(stderr, "Erreur: %s : ligne %ld : attendu \"+ x y\", \"- numero\" ou \"~ numero x y\".\n",
+                    fichier, lecteur->ligne);
+            ok = false;
+        } else {
+            ok = ajouter_modification(delta, &capacite, &modification);
+        }
+    }
+    if (lecteur->erreur) ok = false;
+    fermer_lecteur(lecteur);
+    if (!ok) {
+        liberer_delta(delta);
+        return NULL;
+    }
+    return delta;
+}
+
+void liberer_delta(Delta* delta) {
+    if (delta) {
+        free(delta->modifications);
+        free(delta);
+    }
+}
+
+/*  Matrice de l'instance modifiée : ancien[i] est l'indice dans l'instance d'origine
+    de la ville i si sa position n'a pas changé (-1 sinon). Les indices gardés sont
+    croissants, si bien que chaque ligne est recopiée dans l'ordre de l'ancienne. */
+static long long remplir_matrice(InstanceTSP* nouvelle, const InstanceTSP* instance,
+                                 FonctionDistance dist_func, const int* ancien) {
+    long long calculees = 0;
+    int m = nouvelle->dimension;
+    for (int i = 1; i < m; i++) {
+        double* ligne = nouvelle->matrice_distances[i];
+        const double* ancienne = (ancien[i] >= 0 && instance->matrice_existe)
+                               ? instance->matrice_distances[ancien[i]] : NULL;
+        for (int j = 0; j < i; j++) {
+            if (ancienne && ancien[j] >= 0) {
+                ligne[j] = ancienne[ancien[j]];
+            } else {
+                ligne[j] = dist_func(&nouvelle->villes[i], &nouvelle->villes[j]);
+                calculees++;
+            }
+        }
+    }
+    return calculees;
+}
+
+// Tournée en cours de réparation : liste doublement chaînée circulaire
+typedef struct {
+    const InstanceTSP* instance;
+    FonctionDistance dist_func;
+    int* suivante;
+    int* precedente;
+    bool* dans_tournee;
+    int premiere;               // -1 : tournée vide
+} TourneeChainee;
+
+static double cout(const TourneeChainee* t, int a, int b) {
+    return distance_villes(t->instance, t->dist_func, a, b);
+}
+
+static void inserer_apres(TourneeChainee* t, int u, int v) {
+    int w = t->suivante[u];
+    t->suivante[u] = v;
+    t->precedente[v] = u;
+    t->suivante[v] = w;
+    t->precedente[w] = v;
+    t->dans_tournee[v] = true;
+}
+
+// Insertion au moindre coût de v : arêtes voisines de ses candidats déjà placés,
+// toutes les arêtes de la tournée si aucun ne l'est
+static void inserer_ville(TourneeChainee* t, const ListesCandidats* candidats, int v) {
+    if (t->premiere < 0) {
+        t->suivante[v] = t->precedente[v] = v;
+        t->dans_tournee[v] = true;
+        t->premiere = v;
+        return;
+    }
+    double meilleur = INFINITY;
+    int apres = -1;
+    for (int r = 0; candidats && r < candidats->k; r++) {
+        int u = candidats->voisins[(size_t)v * candidats->k + r];
+        if (!t->dans_tournee[u]) continue;
+        int extremites[2] = { t->precedente[u], u };
+        for (int e = 0; e < 2; e++) {
+            int a = extremites[e];
+            int b = t->suivante[a];
+            double surcout = cout(t, a, v) + cout(t, v, b) - cout(t, a, b);
+            if (surcout < meilleur) {
+                meilleur = surcout;
+                apres = a;
+            }
+        }
+    }
+    if (apres < 0) {
+        int a = t->premiere;
+        do {
+            int b = t->suivante[a];
+            double surcout = cout(t, a, v) + cout(t, v, b) - cout(t, a, b);
+            if (surcout < meilleur) {
+                meilleur = surcout;
+                apres = a;
+            }
+            a = b;
+        } while (a != t->premiere);
+    }
+    inserer_apres(t, apres, v);
+}
+
+/*  Réparation de la tournée dans l'instance modifiée : villes gardées dans l'ordre
+    de l'ancienne tournée, villes ajoutées ou déplacées insérées, recherche locale
+    à partir des villes touchées seulement. */
+static Tournee* reparer_tournee(const InstanceTSP* nouvelle, FonctionDistance dist_func,
+                                const Tournee* tournee, const int* nouvel_indice,
+                                const int* a_inserer, int nb_a_inserer, ResumeDelta* resume) {
+    int m = nouvelle->dimension;
+    TourneeChainee t = { nouvelle, dist_func, (int*)malloc(m * sizeof(int)), (int*)malloc(m * sizeof(int)),
+                         (bool*)calloc(m, sizeof(bool)), -1 };
+    bool* touchee = (bool*)calloc(m, sizeof(bool));
+    ListesCandidats* candidats = calculer_candidats(nouvelle, dist_func, NB_CANDIDATS_DEFAUT);
+    Tournee* reparee = creer_tournee(m);
+    if (!t.suivante || !t.precedente || !t.dans_tournee || !touchee || !reparee || (m > 1 && !candidats)) {
+        free(t.suivante);
+        free(t.precedente);
+        free(t.dans_tournee);
+        free(touchee);
+        liberer_candidats(candidats);
+        liberer_tournee(reparee);
+        return NULL;
+    }
+
+    // Villes gardées ; les deux extrémités de chaque trou laissé par un retrait sont touchées
+    int derniere = -1;
+    bool trou = false;
+    bool trou_initial = false;
+    for (int p = 0; p < tournee->taille; p++) {
+        int v = nouvel_indice[tournee->chemin[p] - 1];
+        if (v < 0 || t.dans_tournee[v]) {
+            trou = true;
+            continue;
+        }
+        if (derniere < 0) {
+            t.premiere = v;
+            trou_initial = trou;
+        } else {
+            t.suivante[derniere] = v;
+            t.precedente[v] = derniere;
+            if (trou) touchee[derniere] = touchee[v] = true;
+        }
+        t.dans_tournee[v] = true;
+        derniere = v;
+        trou = false;
+    }
+    if (derniere >= 0) {
+        t.suivante[derniere] = t.premiere;
+        t.precedente[t.premiere] = derniere;
+        if (trou || trou_initial) touchee[derniere] = touchee[t.premiere] = true;
+    }
+
+    for (int i = 0; i < nb_a_inserer; i++) {
+        inserer_ville(&t, candidats, a_inserer[i]);
+    }
+    for (int i = 0; i < nb_a_inserer; i++) {
+        int v = a_inserer[i];
+        touchee[v] = touchee[t.suivante[v]] = touchee[t.precedente[v]] = true;
+    }
+
+    // Tournée 1-indexée à partir de la première ville gardée (ou insérée)
+    int v = t.premiere;
+    for (int p = 0; p < m; p++) {
+        reparee->chemin[p] = v + 1;
+        v = t.suivante[v];
+    }
+    resume->longueur_inseree = calculer_longueur_tournee(reparee, nouvelle, dist_func);
+
+    resume->villes_reexaminees = 0;
+    for (int i = 0; i < m; i++) {
+        if (touchee[i]) resume->villes_reexaminees++;
+    }
+    if (m >= 8 && resume->villes_reexaminees > 0) {
+        TourneeTableau* tableau = creer_tournee_tableau(reparee);
+        RechercheLocale* recherche = tableau ? creer_recherche_locale(nouvelle, dist_func, candidats, tableau)
+                                             : NULL;
+        if (recherche) {
+            for (int i = 0; i < m; i++) {
+                if (touchee[i]) recherche_locale_activer(recherche, i);
+            }
+            recherche_locale_optimiser(recherche);
+            tableau_vers_tournee(tableau, reparee);
+            calculer_longueur_tournee(reparee, nouvelle, dist_func);
+        }
+        liberer_recherche_locale(recherche);
+        liberer_tournee_tableau(tableau);
+    }
+
+    free(t.suivante);
+    free(t.precedente);
+    free(t.dans_tournee);
+    free(touchee);
+    liberer_candidats(candidats);
+    return reparee;
+}
+
+InstanceTSP* appliquer_delta(const InstanceTSP* instance, FonctionDistance dist_func,
+                             const Tournee* tournee, const Delta* delta,
+                             Tournee** tournee_reparee, ResumeDelta* resume) {
+    int n = instance->dimension;
+    if (instance->type_distance == DIST_EXPLICIT) {
+        fprintf(stderr, "Erreur: une instance EXPLICIT n'a pas de coordonnées à modifier.\n");
+        return NULL;
+    }
+    if (!tournee || tournee->taille != n) {
+        fprintf(stderr, "Erreur: la tournée à réparer n'a pas %d villes.\n", n);
+        return NULL;
+    }
+    memset(resume, 0, sizeof(*resume));
+
+    int* indice_de_numero = (int*)calloc(n + 1, sizeof(int));
+    char* etat = (char*)calloc(n, 1);
+    int* deplacement = (int*)malloc(n * sizeof(int));       // Modification qui déplace la ville
+    int* nouveau_numero = (int*)malloc((n + 1) * sizeof(int));
+    int* nouvel_indice = (int*)malloc(n * sizeof(int));
+    bool ok = indice_de_numero && etat && deplacement && nouveau_numero && nouvel_indice;
+    for (int i = 0; ok && i < n; i++) {
+        int numero = instance->villes[i].numero;
+        if (numero < 1 || numero > n || indice_de_numero[numero]) {
+            fprintf(stderr, "Erreur: villes de l'instance non numérotées de 1 à %d.\n", n);
+            ok = false;
+        } else {
+            indice_de_numero[numero] = i + 1;
+        }
+    }
+    for (int d = 0; ok && d < delta->nb; d++) {
+        const Modification* modification = &delta->modifications[d];
+        if (modification->type == MODIFICATION_AJOUT) {
+            resume->nb_ajouts++;
+            continue;
+        }
+        if (modification->numero > n) {
+            fprintf(stderr, "Erreur: ville %d absente de l'instance (%d villes).\n", modification->numero, n);
+            ok = false;
+            break;
+        }
+        int i = indice_de_numero[modification->numero] - 1;
+        if (etat[i] != VILLE_GARDEE) {
+            fprintf(stderr, "Erreur: ville %d modifiée deux fois.\n", modification->numero);
+            ok = false;
+        } else if (modification->type == MODIFICATION_RETRAIT) {
+            etat[i] = VILLE_RETIREE;
+            resume->nb_retraits++;
+        } else {
+            etat[i] = VILLE_DEPLACEE;
+            deplacement[i] = d;
+            resume->nb_deplacements++;
+        }
+    }
+    int nb_gardees = n - resume->nb_retraits;
+    int m = nb_gardees + resume->nb_ajouts;
+    if (ok && m < 1) {
+        fprintf(stderr, "Erreur: le delta retire toutes les villes.\n");
+        ok = false;
+    }
+
+    InstanceTSP* nouvelle = ok ? (InstanceTSP*)calloc(1, sizeof(InstanceTSP)) : NULL;
+    int* ancien = nouvelle ? (int*)malloc(m * sizeof(int)) : NULL;
+    int* a_inserer = nouvelle ? (int*)malloc((resume->nb_ajouts + resume->nb_deplacements + 1) * sizeof(int))
+                              : NULL;
+    if (nouvelle) {
+        nouvelle->villes = (Ville*)malloc(m * sizeof(Ville));
+    }
+    ok = nouvelle && ancien && a_inserer && nouvelle->villes;
+    if (ok) {
+        memcpy(nouvelle->nom, instance->nom, sizeof(nouvelle->nom));
+        memcpy(nouvelle->commentaire, instance->commentaire, sizeof(nouvelle->commentaire));
+        nouvelle->dimension = m;
+        nouvelle->type_distance = instance->type_distance;
+
+        // Numéros compactés : trous des villes retirées comblés dans l'ordre des numéros
+        int rang = 0;
+        for (int numero = 1; numero <= n; numero++) {
+            if (etat[indice_de_numero[numero] - 1] != VILLE_RETIREE) nouveau_numero[numero] = ++rang;
+        }
+        int nb_a_inserer = 0;
+        int k = 0;
+        for (int i = 0; i < n; i++) {
+            if (etat[i] == VILLE_RETIREE) {
+                nouvel_indice[i] = -1;
+                continue;
+            }
+            nouvelle->villes[k] = instance->villes[i];
+            nouvelle->villes[k].numero = nouveau_numero[instance->villes[i].numero];
+            ancien[k] = i;
+            if (etat[i] == VILLE_DEPLACEE) {
+                nouvelle->villes[k].x = delta->modifications[deplacement[i]].x;
+                nouvelle->villes[k].y = delta->modifications[deplacement[i]].y;
+                ancien[k] = -1;
+            }
+            nouvel_indice[i] = k++;
+        }
+        // Insertions dans l'ordre du fichier : villes déplacées et ajoutées
+        for (int d = 0; d < delta->nb; d++) {
+            const Modification* modification = &delta->modifications[d];
+            if (modification->type == MODIFICATION_AJOUT) {
+                nouvelle->villes[k].numero = k + 1;
+                nouvelle->villes[k].x = modification->x;
+                nouvelle->villes[k].y = modification->y;
+                ancien[k] = -1;
+                a_inserer[nb_a_inserer++] = k++;
+            } else if (modification->type == MODIFICATION_DEPLACEMENT) {
+                a_inserer[nb_a_inserer++] = nouvel_indice[indice_de_numero[modification->numero] - 1];
+            }
+        }
+
+        // Ville déplacée : retirée de l'ancienne tournée (nouvel_indice -1) puis réinsérée
+        for (int i = 0; i < n; i++) {
+            if (etat[i] == VILLE_DEPLACEE) nouvel_indice[i] = -1;
+        }
+        if (m <= DIMENSION_MAX_MATRICE && allouer_matrice_distances(nouvelle)) {
+            resume->distances_calculees = remplir_matrice(nouvelle, instance, dist_func, ancien);
+        }
+        *tournee_reparee = reparer_tournee(nouvelle, dist_func, tournee, nouvel_indice,
+                                           a_inserer, nb_a_inserer, resume);
+        ok = *tournee_reparee != NULL;
+    }
+
+    free(indice_de_numero);
+    free(etat);
+    free(deplacement);
+    free(nouveau_numero);
+    free(nouvel_indice);
+    free(ancien);
+    free(a_inserer);
+    if (!ok) {
+        if (nouvelle && !nouvelle->villes) free(nouvelle);
+        else liberer_instance(nouvelle);
+        return NULL;
+    }
+    return nouvelle;
+}
+
+bool ecrire_instance_tsplib(const char* fichier, const InstanceTSP* instance) {
+    const char* type = instance->type_distance == DIST_GEO ? "GEO"
+                     : instance->type_distance == DIST_ATT ? "ATT" : "EUC_2D";
+    if (instance->type_distance == DIST_EXPLICIT) {
+        fprintf(stderr, "Erreur: écriture d'une instance EXPLICIT non supportée.\n");
+        return false;
+    }
+    int n = instance->dimension;
+    const Ville** par_numero = (const Ville**)calloc(n + 1, sizeof(Ville*));
+    FILE* f = par_numero ? fopen(fichier, "w") : NULL;
+    if (!f) {
+        perror("Erreur écriture de l'instance");
+        free(par_numero);
+        return false;
+    }
+    for (int i = 0; i < n; i++) {
+        int numero = instance->villes[i].numero;
+        if (numero >= 1 && numero <= n) par_numero[numero] = &instance->villes[i];
+    }
+    fprintf(f, "NAME : %s\n", instance->nom);
+    if (instance->commentaire[0]) fprintf(f, "COMMENT : %s\n", instance->commentaire);
+    fprintf(f, "TYPE : TSP\nDIMENSION : %d\nEDGE_WEIGHT_TYPE : %s\nNODE_COORD_SECTION\n", n, type);
+    for (int numero = 1; numero <= n; numero++) {
+        if (par_numero[numero]) {
+            fprintf(f, "%d %.15g %.15g\n", numero, par_numero[numero]->x, par_numero[numero]->y);
+        }
+    }
+    fprintf(f, "EOF\n");
+    bool ok = fclose(f) == 0;
+    if (!ok) perror("Erreur écriture de l'instance");
+    free(par_numero);
+    return ok;
+}
@@ -0,0 +1,59 @@
+#ifndef DYNAMIQUE_H
+#define DYNAMIQUE_H
+
+#include <stdbool.h>
+#include "tsp.h"
+
+/*  Fichier de modifications (texte, éventuellement .gz), une par ligne, '#' : commentaire
+        + x y           ville ajoutée
+        - numero        ville retirée
+        ~ numero x y    ville déplacée
+    Les numéros sont ceux de l'instance courante. */
+typedef enum {
+    MODIFICATION_AJOUT,
+    MODIFICATION_RETRAIT,
+    MODIFICATION_DEPLACEMENT
+} TypeModification;
+
+typedef struct {
+    TypeModification type;
+    int numero;             // Retrait, déplacement
+    double x;               // Ajout, déplacement
+    double y;
+} Modification;
+
+typedef struct {
+    Modification* modifications;
+    int nb;
+} Delta;
+
+// NULL (message sur stderr) si le fichier est illisible ou mal formé
+Delta* lire_fichier_delta(const char* fichier);
+void liberer_delta(Delta* delta);
+
+typedef struct {
+    int nb_ajouts;
+    int nb_retraits;
+    int nb_deplacements;
+    long long distances_calculees;  // Entrées de la matrice calculées (les autres sont recopiées)
+    int villes_reexaminees;         // Villes activées pour la recherche locale
+    double longueur_inseree;        // Après les insertions, avant la recherche locale
+} ResumeDelta;
+
+/**
+ * Applique 'delta' à l'instance et retourne l'instance modifiée (ni candidats ni
+ * borne) : villes gardées dans le même ordre et renumérotées de 1 à m dans l'ordre
+ * de leurs numéros, villes ajoutées à la suite. La matrice reprend les distances
+ * des villes ni ajoutées ni déplacées. La tournée 'tournee' de l'instance d'origine
+ * est réparée dans *tournee_reparee : villes retirées ou déplacées enlevées,
+ * insertion au moindre coût parmi les candidats des villes ajoutées ou déplacées,
+ * puis 2-opt / Or-opt limités aux villes touchées. NULL si le delta ne s'applique pas.
+ */
+InstanceTSP* appliquer_delta(const InstanceTSP* instance, FonctionDistance dist_func,
+                             const Tournee* tournee, const Delta* delta,
+                             Tournee** tournee_reparee, ResumeDelta* resume);
+
+// Écrit l'instance au format TSPLIB (NODE_COORD_SECTION, villes dans l'ordre des numéros)
+bool ecrire_instance_tsplib(const char* fichier, const InstanceTSP* instance);
+
+#endif
@@ -0,0 +1,185 @@
+/**
+ * fichier_tournee.c
+ * Écriture des tournées : texte formaté d'un bloc, fichiers TSPLIB .tour et binaires
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <zlib.h>
+
+#include "fichier_tournee.h"
+
+#define SIGNATURE_TOURNEE "TSPTOURB"
+#define VERSION_TOURNEE 1
+#define BOUTISME_NATIF 0x01020304u
+
+typedef struct {
+    char signature[8];
+    uint32_t version;
+    uint32_t boutisme;
+    int32_t dimension;
+    int32_t reserve;
+    double longueur;
+} EnTeteTournee;
+
+// Paires de chiffres "00" à "99" : deux chiffres par division
+static const char PAIRES[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+static char* ecrire_entier(char* p, int valeur) {
+    char chiffres[12];
+    char* q = chiffres + sizeof(chiffres);
+    unsigned v = valeur < 0 ? 0u - (unsigned)valeur : (unsigned)valeur;
+    while (v >= 100) {
+        unsigned r = v % 100;
+        v /= 100;
+        q -= 2;
+        memcpy(q, PAIRES + 2 * r, 2);
+    }
+    if (v >= 10) {
+        q -= 2;
+        memcpy(q, PAIRES + 2 * v, 2);
+    } else {
+        *--q = (char)('0' + v);
+    }
+    if (valeur < 0) *--q = '-';
+    size_t longueur = (size_t)(chiffres + sizeof(chiffres) - q);
+    memcpy(p, q, longueur);
+    return p + longueur;
+}
+
+size_t formater_numeros_tournee(char* tampon, const InstanceTSP* instance, const Tournee* tournee,
+                                char separateur) {
+    char* p = tampon;
+    for (int i = 0; i < tournee->taille; i++) {
+        if (i > 0) *p++ = separateur;
+        // Numéros TSPLIB d'origine (les villes peuvent avoir été renumérotées au chargement)
+        p = ecrire_entier(p, instance->villes[tournee->chemin[i] - 1].numero);
+    }
+    return (size_t)(p - tampon);
+}
+
+static bool finit_par(const char* texte, const char* suffixe) {
+    size_t n = strlen(texte), m = strlen(suffixe);
+    return n >= m && strcmp(texte + n - m, suffixe) == 0;
+}
+
+// Écrit 'taille' octets dans 'fichier.tmp' (compressés si 'gzip') puis renomme
+static bool ecrire_atomiquement(const char* fichier, const void* donnees, size_t taille, bool gzip) {
+    char temporaire[4096];
+    snprintf(temporaire, sizeof(temporaire), "%s.tmp", fichier);
+    bool ok;
+    if (gzip) {
+        gzFile f = gzopen(temporaire, "wb");
+        ok = f != NULL;
+        // gzwrite prend un unsigned : écriture par morceaux
+        const char* p = (const char*)donnees;
+        while (ok && taille > 0) {
+            unsigned morceau = taille > (1u << 30) ? (1u << 30) : (unsigned)taille;
+            ok = gzwrite(f, p, morceau) == (int)morceau;
+            p += morceau;
+            taille -= morceau;
+        }
+        if (f) ok = (gzclose(f) == Z_OK) && ok;
+    } else {
+        FILE* f = fopen(temporaire, "wb");
+        ok = f && fwrite(donnees, 1, taille, f) == taille;
+        if (f) ok = (fclose(f) == 0) && ok;
+    }
+    if (ok && rename(temporaire, fichier) != 0) ok = false;
+    if (!ok) {
+        perror("Erreur écriture de la tournée");
+        remove(temporaire);
+    }
+    return ok;
+}
+
+bool ecrire_fichier_tour(const char* fichier, const InstanceTSP* instance, const Tournee* tournee,
+                         const char* methode) {
+    char entete[NOM_MAX + 256];
+    int longueur_entete = snprintf(entete, sizeof(entete),
+                                   "NAME : %s.%s.tour\nCOMMENT : Longueur %.6f (%s)\nTYPE : TOUR\n"
+                                   "DIMENSION : %d\nTOUR_SECTION\n",
+                                   instance->nom, methode, tournee->distanceTotale, methode,
+                                   tournee->taille);
+    if (longueur_entete < 0 || (size_t)longueur_entete >= sizeof(entete)) return false;
+
+    // Tout le fichier dans un seul tampon : en-tête, une ville par ligne, -1 et EOF
+    char* tampon = (char*)malloc((size_t)longueur_entete + TAILLE_NUMEROS_TOURNEE(tournee->taille) + 16);
+    if (!tampon) return false;
+    memcpy(tampon, entete, (size_t)longueur_entete);
+    size_t taille = (size_t)longueur_entete;
+    taille += formater_numeros_tournee(tampon + taille, instance, tournee, '\n');
+    memcpy(tampon + taille, "\n-1\nEOF\n", 8);
+    taille += 8;
+    bool ok = ecrire_atomiquement(fichier, tampon, taille, finit_par(fichier, ".gz"));
+    free(tampon);
+    return ok;
+}
+
+bool ecrire_tournee_binaire(const char* fichier, const InstanceTSP* instance, const Tournee* tournee) {
+    size_t taille = sizeof(EnTeteTournee) + (size_t)tournee->taille * sizeof(int32_t);
+    char* tampon = (char*)malloc(taille);
+    if (!tampon) return false;
+    EnTeteTournee entete;
+    memset(&entete, 0, sizeof(entete));
+    memcpy(entete.signature, SIGNATURE_TOURNEE, sizeof(entete.signature));
+    entete.version = VERSION_TOURNEE;
+    entete.boutisme = BOUTISME_NATIF;
+    entete.dimension = tournee->taille;
+    entete.longueur = tournee->distanceTotale;
+    memcpy(tampon, &entete, sizeof(entete));
+    int32_t* numeros = (int32_t*)(tampon + sizeof(entete));
+    for (int i = 0; i < tournee->taille; i++) {
+        numeros[i] = instance->villes[tournee->chemin[i] - 1].numero;
+    }
+    bool ok = ecrire_atomiquement(fichier, tampon, taille, false);
+    free(tampon);
+    return ok;
+}
+
+bool est_tournee_binaire(const char* fichier) {
+    char signature[8];
+    FILE* f = fopen(fichier, "rb");
+    if (!f) return false;
+    bool binaire = fread(signature, 1, sizeof(signature), f) == sizeof(signature)
+                && memcmp(signature, SIGNATURE_TOURNEE, sizeof(signature)) == 0;
+    fclose(f);
+    return binaire;
+}
+
+int* lire_tournee_binaire(const char* fichier, int* taille) {
+    FILE* f = fopen(fichier, "rb");
+    if (!f) {
+        perror("Erreur ouverture du fichier");
+        return NULL;
+    }
+    EnTeteTournee entete;
+    const char* erreur = NULL;
+    int* numeros = NULL;
+    if (fread(&entete, sizeof(entete), 1, f) != 1) erreur = "fichier tronqué";
+    else if (entete.version != VERSION_TOURNEE) erreur = "version non supportée";
+    else if (entete.boutisme != BOUTISME_NATIF) erreur = "écrite sur une autre architecture";
+    else if (entete.dimension <= 0) erreur = "en-tête invalide";
+    if (!erreur) {
+        numeros = (int*)malloc((size_t)entete.dimension * sizeof(int));
+        if (!numeros || fread(numeros, sizeof(int32_t), (size_t)entete.dimension, f)
+                        != (size_t)entete.dimension) {
+            erreur = "fichier tronqué";
+        } else if (fgetc(f) != EOF) {
+            erreur = "données après la tournée";
+        }
+    }
+    fclose(f);
+    if (erreur) {
+        fprintf(stderr, "Erreur: tournée binaire '%s' : %s.\n", fichier, erreur);
+        free(numeros);
+        return NULL;
+    }
+    *taille = entete.dimension;
+    return numeros;
+}
@@ -0,0 +1,27 @@
+#ifndef FICHIER_TOURNEE_H
+#define FICHIER_TOURNEE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "tsp.h"
+
+// Taille maximale du texte de formater_numeros_tournee : 10 chiffres et un séparateur par ville
+#define TAILLE_NUMEROS_TOURNEE(n) ((size_t)(n) * 11 + 1)
+
+// Écrit dans 'tampon' les numéros TSPLIB des villes de la tournée, séparés par
+// 'separateur' (sans séparateur final) ; retourne le nombre d'octets écrits
+size_t formater_numeros_tournee(char* tampon, const InstanceTSP* instance, const Tournee* tournee,
+                                char separateur);
+
+// Fichier TSPLIB TYPE : TOUR (compressé par gzip si le nom finit par .gz)
+bool ecrire_fichier_tour(const char* fichier, const InstanceTSP* instance, const Tournee* tournee,
+                         const char* methode);
+
+/*  Tournée binaire : en-tête de 32 octets ("TSPTOURB", version, boutisme,
+    dimension, longueur) suivi des numéros TSPLIB en int32 natifs. */
+bool ecrire_tournee_binaire(const char* fichier, const InstanceTSP* instance, const Tournee* tournee);
+bool est_tournee_binaire(const char* fichier);
+// Numéros TSPLIB de la tournée (à libérer), 'taille' villes ; NULL si le fichier est invalide
+int* lire_tournee_binaire(const char* fichier, int* taille);
+
+#endif
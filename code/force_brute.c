@@ -9,6 +9,8 @@
 
 #include "force_brute.h"
 #include "tsp_utils.h" // Pour creer/copier/liberer_tournee
+#include "chrono.h"
+#include "checkpoint.h"
 
 
 
@@ -100,14 +102,70 @@ static bool permutation_suivante(int tableau[], size_t longueur) {
 }
                           
 
+// POINTS DE REPRISE
+// Contenu : nombre de permutations évaluées, dernière permutation évaluée
+// (villes 2..n), meilleure et pire tournées avec leurs longueurs
+
+static bool ecrire_tournee(FILE* f, const Tournee* tournee) {
+    return checkpoint_ecrire(f, tournee->chemin, tournee->taille * sizeof(int))
+        && checkpoint_ecrire(f, &tournee->distanceTotale, sizeof(double));
+}
+
+static bool lire_tournee(FILE* f, Tournee* tournee) {
+    return checkpoint_lire(f, tournee->chemin, tournee->taille * sizeof(int))
+        && checkpoint_lire(f, &tournee->distanceTotale, sizeof(double));
+}
+
+static bool ecrire_point_reprise(const char* fichier, const InstanceTSP* instance,
+                                 const int* sous_chemin, long long nb_evaluees) {
+    FILE* f = checkpoint_ouvrir_ecriture(fichier, CHECKPOINT_FORCE_BRUTE, instance);
+    if (!f) return false;
+    bool ok = checkpoint_ecrire(f, &nb_evaluees, sizeof(long long))
+           && checkpoint_ecrire(f, sous_chemin, (instance->dimension - 1) * sizeof(int))
+           && ecrire_tournee(f, meilleure_globale)
+           && ecrire_tournee(f, pire_globale);
+    return checkpoint_terminer_ecriture(f, fichier) && ok;
+}
+
+static bool lire_point_reprise(const char* fichier, const InstanceTSP* instance,
+                               int* sous_chemin, long long* nb_evaluees) {
+    FILE* f = checkpoint_ouvrir_lecture(fichier, CHECKPOINT_FORCE_BRUTE, instance);
+    if (!f) return false;
+    bool ok = checkpoint_lire(f, nb_evaluees, sizeof(long long))
+           && checkpoint_lire(f, sous_chemin, (instance->dimension - 1) * sizeof(int))
+           && lire_tournee(f, meilleure_globale)
+           && lire_tournee(f, pire_globale);
+    fclose(f);
+    if (!ok) {
+        fprintf(stderr, "Erreur: point de reprise '%s' tronqué.\n", fichier);
+        return false;
+    }
+    // Sous-chemin : villes 2..n ; tournées : villes 1..n
+    int n = instance->dimension;
+    if (!checkpoint_permutation_valide(sous_chemin, n - 1, 2)
+        || !checkpoint_permutation_valide(meilleure_globale->chemin, n, 1)
+        || !checkpoint_permutation_valide(pire_globale->chemin, n, 1)) {
+        fprintf(stderr, "Erreur: point de reprise '%s' : tournée invalide.\n", fichier);
+        return false;
+    }
+    return true;
+}
+
+
 // ALGORITHME DE FORCE BRUTE
 
 int resoudre_force_brute(InstanceTSP* instance, 
                          FonctionDistance dist_func,
                          Tournee** meilleure, 
                          Tournee** pire) {
-    
-                            
+    return resoudre_force_brute_reprise(instance, dist_func, meilleure, pire, NULL);
+}
+
+int resoudre_force_brute_reprise(InstanceTSP* instance,
+                                 FonctionDistance dist_func,
+                                 Tournee** meilleure,
+                                 Tournee** pire,
+                                 const ParamsCheckpoint* checkpoint) {
     int n = instance->dimension;
     interruption_recue = 0; // Réinitialiser au cas où
     
@@ -135,8 +193,44 @@ int resoudre_force_brute(InstanceTSP* instance,
     for (int i = 0; i < n - 1; i++) {
         sous_chemin[i] = i + 2;  // [2, 3, 4, ..., n]
     }
-        
+
+    // Reprise : la permutation relue a déjà été évaluée, on repart de la suivante
+    long long nb_evaluees = 0;
+    if (checkpoint && checkpoint->reprise) {
+        if (!lire_point_reprise(checkpoint->reprise, instance, sous_chemin, &nb_evaluees)) {
+            *meilleure = meilleure_globale;
+            *pire = pire_globale;
+            free(sous_chemin);
+            liberer_tournee(permutation_courante_globale);
+            return 0;
+        }
+        printf("Reprise de '%s' : %lld permutations déjà évaluées\n", checkpoint->reprise, nb_evaluees);
+    }
+    MinuterieCheckpoint minuterie;
+    minuterie_checkpoint_initialiser(&minuterie, checkpoint);
+
     do {
+        // Échéance (-t) et points de reprise vérifiés toutes les 65536 permutations
+        if ((++nb_evaluees & 0xFFFF) == 0) {
+            bool echeance = echeance_atteinte();
+            if (echeance || checkpoint_a_ecrire(&minuterie)) {
+                if (checkpoint && checkpoint->fichier) {
+                    ecrire_point_reprise(checkpoint->fichier, instance, sous_chemin, nb_evaluees);
+                }
+                // SIGTERM : arrêt après l'écriture, la reprise continuera le calcul
+                if (checkpoint_arret_demande()) {
+                    printf("Arrêt demandé : point de reprise écrit dans '%s'\n", checkpoint->fichier);
+                    *meilleure = meilleure_globale;
+                    *pire = pire_globale;
+                    free(sous_chemin);
+                    liberer_tournee(permutation_courante_globale);
+                    return 0;
+                }
+            }
+            // Échéance (-t) : meilleure et pire tournées parmi celles évaluées
+            if (echeance) break;
+        }
+
         // Vérifier interruption
         if (interruption_recue) {
             afficher_etat_actuel();
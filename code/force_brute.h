@@ -3,13 +3,23 @@
 
 #include "tsp.h"
 #include "tsp_utils.h"
+#include "checkpoint.h"
 
 // Résout le problème du TSP par la méthode de force brute.
+// À l'échéance du thread (chrono.h), retourne les meilleure et pire tournées évaluées.
 int resoudre_force_brute(InstanceTSP* instance, 
                          FonctionDistance dist_func,
                          Tournee** meilleure, 
                          Tournee** pire);
 
+// Idem avec points de reprise : écrits périodiquement, à l'échéance et à la réception
+// de SIGTERM (retourne alors 0), relus au démarrage si checkpoint->reprise est donné
+int resoudre_force_brute_reprise(InstanceTSP* instance,
+                                 FonctionDistance dist_func,
+                                 Tournee** meilleure,
+                                 Tournee** pire,
+                                 const ParamsCheckpoint* checkpoint);
+
 
 
 // Gestionnaire de signal pour SIGINT (Ctrl+C).
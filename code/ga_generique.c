@@ -14,8 +14,15 @@
 #include "distance.h"
 #include "matrice.h"
 #include "ga_generique.h"
+#include "chrono.h"
+#include "mesures.h"
+#include "alea.h"
 
 
+// Générateur de l'algorithme en cours dans ce thread (initialisé avec params->graine) :
+// son état fait partie des points de reprise
+static __thread Alea alea_ga;
+
 typedef struct {
     int ville1;
     int ville2;
@@ -80,7 +87,7 @@ void initialiser_population(Population* pop, const InstanceTSP* instance,
     FonctionDistance dist_func) {
     for (int i = 0; i < pop->taille; i++) {
         // Utiliser marche_aleatoire pour créer chaque individu
-        Tournee* tournee_aleatoire = marche_aleatoire(instance, dist_func);
+        Tournee* tournee_aleatoire = marche_aleatoire(instance, dist_func, &alea_ga);
         if (tournee_aleatoire) {
             copier_tournee(pop->individus[i], tournee_aleatoire);
             liberer_tournee(tournee_aleatoire);
@@ -103,9 +110,9 @@ void evaluer_population(Population* pop, const InstanceTSP* instance,
 
 // Sélection aléatoire simple de deux individus
 void selectionner_deux_parents(const Population* pop, int* idx1, int* idx2) {
-    *idx1 = rand() % pop->taille;
+    *idx1 = alea_entier(&alea_ga, pop->taille);
     do {
-        *idx2 = rand() % pop->taille;
+        *idx2 = alea_entier(&alea_ga, pop->taille);
     } while (*idx2 == *idx1);
 }
 
@@ -119,8 +126,8 @@ Tournee* croisement_ordonne(const Tournee* parent1, const Tournee* parent2) {
     }
 
     // Choisir deux points de croisement aléatoires
-    int point1 = rand() % n;
-    int point2 = rand() % n;
+    int point1 = alea_entier(&alea_ga, n);
+    int point2 = alea_entier(&alea_ga, n);
 
     if (point1 > point2) {
         int temp = point1;
@@ -360,10 +367,10 @@ void mutation_echange(Tournee* tournee, double taux_mutation) {
 
     // Pour chaque position, décider si on mute
     for (int i = 0; i < n; i++) {
-        double r = (double)rand() / RAND_MAX;
+        double r = alea_reel(&alea_ga);
         if (r < taux_mutation) {
             // Échanger avec une position aléatoire
-            int j = rand() % n;
+            int j = alea_entier(&alea_ga, n);
             int temp = tournee->chemin[i];
             tournee->chemin[i] = tournee->chemin[j];
             tournee->chemin[j] = temp;
@@ -399,37 +406,128 @@ int trouver_pire(const Population* pop) {
     return pire;
 }
 
+//                      POINTS DE REPRISE
+// Contenu : croisement, prochaine génération, taille de la population, état du
+// générateur, individus et longueurs, meilleur individu et sa longueur
+
+static bool ecrire_point_reprise(const char* fichier, const InstanceTSP* instance,
+                                 const Population* pop, const Tournee* meilleur,
+                                 int32_t croisement, int32_t generation) {
+    FILE* f = checkpoint_ouvrir_ecriture(fichier, CHECKPOINT_GA, instance);
+    if (!f) return false;
+    int32_t taille = pop->taille;
+    bool ok = checkpoint_ecrire(f, &croisement, sizeof(int32_t))
+           && checkpoint_ecrire(f, &generation, sizeof(int32_t))
+           && checkpoint_ecrire(f, &taille, sizeof(int32_t))
+           && checkpoint_ecrire(f, &alea_ga.etat, sizeof(uint64_t));
+    for (int i = 0; ok && i < pop->taille; i++) {
+        ok = checkpoint_ecrire(f, pop->individus[i]->chemin, instance->dimension * sizeof(int));
+    }
+    ok = ok && checkpoint_ecrire(f, pop->distances, pop->taille * sizeof(double))
+            && checkpoint_ecrire(f, meilleur->chemin, instance->dimension * sizeof(int))
+            && checkpoint_ecrire(f, &meilleur->distanceTotale, sizeof(double));
+    return checkpoint_terminer_ecriture(f, fichier) && ok;
+}
+
+static bool lire_point_reprise(const char* fichier, const InstanceTSP* instance,
+                               Population* pop, Tournee* meilleur,
+                               int32_t croisement, int32_t* generation) {
+    FILE* f = checkpoint_ouvrir_lecture(fichier, CHECKPOINT_GA, instance);
+    if (!f) return false;
+    int32_t croisement_lu, taille;
+    bool ok = checkpoint_lire(f, &croisement_lu, sizeof(int32_t))
+           && checkpoint_lire(f, generation, sizeof(int32_t))
+           && checkpoint_lire(f, &taille, sizeof(int32_t))
+           && checkpoint_lire(f, &alea_ga.etat, sizeof(uint64_t));
+    if (ok && (croisement_lu != croisement || taille != pop->taille)) {
+        fprintf(stderr, "Erreur: point de reprise '%s' : croisement ou taille de population différents.\n",
+                fichier);
+        fclose(f);
+        return false;
+    }
+    for (int i = 0; ok && i < pop->taille; i++) {
+        ok = checkpoint_lire(f, pop->individus[i]->chemin, instance->dimension * sizeof(int));
+    }
+    ok = ok && checkpoint_lire(f, pop->distances, pop->taille * sizeof(double))
+            && checkpoint_lire(f, meilleur->chemin, instance->dimension * sizeof(int))
+            && checkpoint_lire(f, &meilleur->distanceTotale, sizeof(double));
+    fclose(f);
+    if (!ok) {
+        fprintf(stderr, "Erreur: point de reprise '%s' tronqué.\n", fichier);
+        return false;
+    }
+    // Tournées en numérotation 1..n
+    ok = checkpoint_permutation_valide(meilleur->chemin, instance->dimension, 1);
+    for (int i = 0; ok && i < pop->taille; i++) {
+        ok = checkpoint_permutation_valide(pop->individus[i]->chemin, instance->dimension, 1);
+    }
+    if (!ok) {
+        fprintf(stderr, "Erreur: point de reprise '%s' : tournée invalide.\n", fichier);
+        return false;
+    }
+    for (int i = 0; i < pop->taille; i++) {
+        pop->individus[i]->distanceTotale = pop->distances[i];
+    }
+    return true;
+}
+
 Tournee* algorithme_genetique(const InstanceTSP* instance,
     FonctionDistance dist_func,
     const ParamsGA* params,
     Tournee* foncCroisement(const Tournee* parent1, const Tournee* parent2)) {
 
     int dimension = instance->dimension;
+    const ParamsCheckpoint* checkpoint = params->checkpoint;
+    int32_t croisement = (foncCroisement == croisement_dpx) ? 1 : 0;
+    alea_initialiser(&alea_ga, params->graine);
 
     // Créer la population initiale
     Population* population = creer_population(params->taille_population, dimension);
-    if (!population) {
+    Tournee* meilleur_global = creer_tournee(dimension);
+    if (!population || !meilleur_global) {
         fprintf(stderr, "Erreur : impossible de créer la population\n");
+        liberer_population(population);
+        liberer_tournee(meilleur_global);
         return NULL;
     }
 
-    // Initialiser avec des tournées aléatoires (utilise marche_aleatoire)
-    initialiser_population(population, instance, dist_func);
+    int32_t premiere_generation = 0;
+    int idx_meilleur;
+    if (checkpoint && checkpoint->reprise) {
+        // Reprise : population, meilleur individu et générateur tels qu'à l'écriture
+        if (!lire_point_reprise(checkpoint->reprise, instance, population, meilleur_global,
+                                croisement, &premiere_generation)) {
+            liberer_population(population);
+            liberer_tournee(meilleur_global);
+            return NULL;
+        }
+        printf("Reprise de '%s' à la génération %d\n", checkpoint->reprise, premiere_generation);
+    } else {
+        // Initialiser avec des tournées aléatoires (marche aléatoire)
+        initialiser_population(population, instance, dist_func);
+        // Départ d'une tournée existante : elle remplace le premier individu
+        if (params->tournee_initiale) {
+            copier_tournee(population->individus[0], params->tournee_initiale);
+        }
 
-    // Évaluer la population initiale
-    evaluer_population(population, instance, dist_func);
+        // Évaluer la population initiale
+        evaluer_population(population, instance, dist_func);
 
-    // Garder trace du meilleur global
-    int idx_meilleur = trouver_meilleur(population);
-    Tournee* meilleur_global = creer_tournee(dimension);
-    copier_tournee(meilleur_global, population->individus[idx_meilleur]);
-    double meilleur_distances = population->distances[idx_meilleur];
+        // Garder trace du meilleur global
+        idx_meilleur = trouver_meilleur(population);
+        copier_tournee(meilleur_global, population->individus[idx_meilleur]);
+    }
+    double meilleur_distances = meilleur_global->distanceTotale;
+
+    MinuterieCheckpoint minuterie;
+    minuterie_checkpoint_initialiser(&minuterie, checkpoint);
+    unsigned long long croisements = 0, rejetes = 0;
 
     // Boucle principale : générations
-    for (int gen = 0; gen < params->nombre_generations; gen++) {
+    for (int gen = premiere_generation; gen < params->nombre_generations && !echeance_atteinte(); gen++) {
 
         // Boucle de croisements
-        for (int crois = 0; crois < params->nb_croisements; crois++) {
+        for (int crois = 0; crois < params->nb_croisements && !echeance_atteinte(); crois++) {
 
             // Sélectionner deux parents au hasard
             int idx_parent1, idx_parent2;
@@ -440,9 +538,10 @@ Tournee* algorithme_genetique(const InstanceTSP* instance,
                 population->individus[idx_parent1],
                 population->individus[idx_parent2]
             );
+            croisements++;
 
             // Mutation avec probabilité taux_mutation
-            double r = (double)rand() / RAND_MAX;
+            double r = alea_reel(&alea_ga);
             if (r < params->taux_mutation) {
                 mutation_echange(fille, params->taux_mutation);
             }
@@ -461,6 +560,7 @@ Tournee* algorithme_genetique(const InstanceTSP* instance,
             }
             else {
                 liberer_tournee(fille);
+                rejetes++;
             }
         }
 
@@ -477,55 +577,25 @@ Tournee* algorithme_genetique(const InstanceTSP* instance,
             copier_tournee(population->individus[idx_pire], meilleur_global);
             population->distances[idx_pire] = meilleur_distances;
         }
+
+        // Point de reprise en fin de génération : la reprise commence à gen + 1
+        bool echeance = echeance_atteinte() && checkpoint && checkpoint->fichier;
+        if (echeance || checkpoint_a_ecrire(&minuterie)) {
+            ecrire_point_reprise(checkpoint->fichier, instance, population, meilleur_global,
+                                 croisement, gen + 1);
+            if (checkpoint_arret_demande()) {
+                printf("Arrêt demandé : point de reprise écrit dans '%s'\n", checkpoint->fichier);
+                break;
+            }
+        }
     }
 
+    MESURES_COMPTER(COMPTEUR_CROISEMENTS, croisements);
+    MESURES_COMPTER(COMPTEUR_ENFANTS_REJETES, rejetes);
+
     // Nettoyer
     liberer_population(population);
 
     return meilleur_global;
 }
 
-void executer_ga(const InstanceTSP* instance, FonctionDistance dist_func,
-    int nb_individus, int nb_generations, double taux_mutation,
-    Tournee* foncCroisement(const Tournee* parent1, const Tournee* parent2)) {
-
-    ParamsGA params;
-    params.taille_population = nb_individus;
-    params.nombre_generations = nb_generations;
-    params.taux_mutation = taux_mutation;
-    params.nb_croisements = nb_individus / 2;
-
-    // Mesurer le temps
-    clock_t debut = clock();
-
-    // Exécuter l'algorithme génétique
-    Tournee* solution = algorithme_genetique(instance, dist_func, &params, foncCroisement);
-
-    clock_t fin = clock();
-    double temps_cpu = ((double)(fin - debut)) / CLOCKS_PER_SEC;
-
-    if (!solution) {
-        fprintf(stderr, "Erreur : échec de l'algorithme génétique\n");
-        return;
-    }
-
-    // Afficher le résultat normalisé
-    if (foncCroisement == croisement_ordonne) {
-        debut = clock();
-        deux_opt(solution, instance, dist_func);
-        fin = clock();
-        temps_cpu += ((double)(fin - debut)) / CLOCKS_PER_SEC;
-        afficher_tournee_normalisee(instance, solution, "ga", temps_cpu);
-    }
-    else if (foncCroisement == croisement_dpx) {
-        debut = clock();
-        deux_opt(solution, instance, dist_func);
-        fin = clock();
-        temps_cpu += ((double)(fin - debut)) / CLOCKS_PER_SEC;
-        afficher_tournee_normalisee(instance, solution, "gadpx", temps_cpu);
-    }
-
-    // Libérer
-    liberer_tournee(solution);
-}
-
@@ -6,7 +6,12 @@
 #ifndef GA_GENERIQUE_H
 #define GA_GENERIQUE_H
 
+#include <stdint.h>
 #include "tsp.h"
+#include "checkpoint.h"
+
+// Graine par défaut (résultats reproductibles)
+#define GRAINE_GA 2025
 
 // Paramètres de l'algorithme génétique
 typedef struct {
@@ -14,6 +19,9 @@ typedef struct {
     int nombre_generations;     // Nombre de générations à exécuter
     double taux_mutation;       // Probabilité de mutation (0.0 à 1.0)
     int nb_croisements;         // Nombre de croisements par génération
+    uint64_t graine;            // Générateur aléatoire (alea.h) : état sauvegardé dans les points de reprise
+    const ParamsCheckpoint* checkpoint;     // Points de reprise (NULL : aucun)
+    const Tournee* tournee_initiale;        // Premier individu (-i) ; NULL : population aléatoire
 } ParamsGA;
 
 // Population d'individus (tournées)
@@ -25,10 +33,8 @@ typedef struct {
 
 //     FONCTIONS PRINCIPALES
 
-void executer_ga(const InstanceTSP* instance, FonctionDistance dist_func,
-                 int nb_individus, int nb_generations, double taux_mutation,
-                Tournee* foncCroisement(const Tournee *parent1, const Tournee *parent2));
-
+// Points de reprise (params->checkpoint) : écrits à la fin d'une génération, toutes les
+// 'intervalle' secondes, à l'échéance et à la réception de SIGTERM (arrêt après l'écriture)
 Tournee* algorithme_genetique(const InstanceTSP* instance, 
                               FonctionDistance dist_func,
                               const ParamsGA* params,
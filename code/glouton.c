@@ -0,0 +1,342 @@
+/**
+ * glouton.c
+ * Heuristique gloutonne sur les arêtes (type Kruskal)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "heuristiques.h"
+#include "tsp_utils.h"
+#include "distance.h"
+#include "matrice.h"
+#include "candidats.h"
+#include "grille.h"
+
+typedef struct {
+    int ville1;
+    int ville2;
+    double distance;
+} AreteCandidate;
+
+static int comparer_aretes(const void* a, const void* b) {
+    const AreteCandidate* e1 = (const AreteCandidate*)a;
+    const AreteCandidate* e2 = (const AreteCandidate*)b;
+    if (e1->distance < e2->distance) return -1;
+    if (e1->distance > e2->distance) return 1;
+    if (e1->ville1 != e2->ville1) return e1->ville1 - e2->ville1;
+    return e1->ville2 - e2->ville2;
+}
+
+// Union-find avec compression de chemin et union par rang
+static int trouver_racine(int* parent, int v) {
+    while (parent[v] != v) {
+        parent[v] = parent[parent[v]];
+        v = parent[v];
+    }
+    return v;
+}
+
+static bool unir(int* parent, int* rang, int a, int b) {
+    a = trouver_racine(parent, a);
+    b = trouver_racine(parent, b);
+    if (a == b) return false;
+    if (rang[a] < rang[b]) { int t = a; a = b; b = t; }
+    parent[b] = a;
+    if (rang[a] == rang[b]) rang[a]++;
+    return true;
+}
+
+static void ajouter_arete(int* adjacence, int* degre, int a, int b) {
+    adjacence[2 * a + degre[a]++] = b;
+    adjacence[2 * b + degre[b]++] = a;
+}
+
+// Extrémité opposée du fragment commençant en 'debut' (degré <= 1)
+static int autre_extremite(const int* adjacence, const int* degre, int debut) {
+    int precedente = -1, courante = debut;
+    while (true) {
+        int suivante = -1;
+        for (int d = 0; d < degre[courante]; d++) {
+            if (adjacence[2 * courante + d] != precedente) {
+                suivante = adjacence[2 * courante + d];
+                break;
+            }
+        }
+        if (suivante == -1) return courante;
+        precedente = courante;
+        courante = suivante;
+    }
+}
+
+/**
+ * Ajoute les arêtes triées tant que les deux extrémités ont un degré < 2
+ * et que l'arête ne ferme pas de cycle. Retourne le nombre d'arêtes ajoutées.
+ */
+static int selection_gloutonne(AreteCandidate* aretes, int nb_aretes, int max_aretes,
+                               int* adjacence, int* degre, int* parent, int* rang) {
+    qsort(aretes, nb_aretes, sizeof(AreteCandidate), comparer_aretes);
+
+    // Les doublons sont rejetés par l'union-find
+    int nb_choisies = 0;
+    for (int e = 0; e < nb_aretes && nb_choisies < max_aretes; e++) {
+        int a = aretes[e].ville1;
+        int b = aretes[e].ville2;
+        if (degre[a] >= 2 || degre[b] >= 2) continue;
+        if (!unir(parent, rang, a, b)) continue;
+        ajouter_arete(adjacence, degre, a, b);
+        nb_choisies++;
+    }
+    return nb_choisies;
+}
+
+/**
+ * Nouvelles passes gloutonnes restreintes aux extrémités libres des fragments :
+ * chaque extrémité propose ses k plus proches extrémités libres.
+ * Retourne le nombre d'arêtes ajoutées au total.
+ */
+static int passes_extremites(const InstanceTSP* instance, FonctionDistance dist_func,
+                             int* adjacence, int* degre, int* parent, int* rang,
+                             int nb_restantes) {
+    int n = instance->dimension;
+    int k = NB_CANDIDATS_DEFAUT;
+    int* libres = (int*)malloc(n * sizeof(int));
+    int* voisins = (int*)malloc(k * sizeof(int));
+    double* distances = (double*)malloc(k * sizeof(double));
+    AreteCandidate* aretes = (AreteCandidate*)malloc((size_t)n * k * sizeof(AreteCandidate));
+    GrilleVilles* grille = NULL;
+    if (distance_planaire(instance->type_distance)) {
+        grille = creer_grille(instance, 2);
+    }
+    int total = 0;
+
+    while (nb_restantes > 0 && libres && voisins && distances && aretes) {
+        int nb_libres = 0;
+        for (int v = 0; v < n; v++) {
+            if (degre[v] < 2) libres[nb_libres++] = v;
+            else if (grille) grille_retirer_ville(grille, v);
+        }
+
+        int nb_aretes = 0;
+        for (int i = 0; i < nb_libres; i++) {
+            int v = libres[i];
+            int nb = 0;
+            if (grille) {
+                nb = grille_k_plus_proches(grille, instance, dist_func, v, k, voisins, distances);
+            } else {
+                for (int j = 0; j < nb_libres; j++) {
+                    int w = libres[j];
+                    if (w == v) continue;
+                    double dist = distance_villes(instance, dist_func, v, w);
+                    if (nb == k && dist >= distances[k - 1]) continue;
+                    int pos = (nb < k) ? nb++ : k - 1;
+                    while (pos > 0 && distances[pos - 1] > dist) {
+                        distances[pos] = distances[pos - 1];
+                        voisins[pos] = voisins[pos - 1];
+                        pos--;
+                    }
+                    distances[pos] = dist;
+                    voisins[pos] = w;
+                }
+            }
+            for (int r = 0; r < nb; r++) {
+                int w = voisins[r];
+                aretes[nb_aretes].ville1 = v < w ? v : w;
+                aretes[nb_aretes].ville2 = v < w ? w : v;
+                aretes[nb_aretes].distance = distances[r];
+                nb_aretes++;
+            }
+        }
+
+        int ajoutees = selection_gloutonne(aretes, nb_aretes, nb_restantes,
+                                           adjacence, degre, parent, rang);
+        if (ajoutees == 0) break;
+        nb_restantes -= ajoutees;
+        total += ajoutees;
+    }
+
+    liberer_grille(grille);
+    free(libres);
+    free(voisins);
+    free(distances);
+    free(aretes);
+    return total;
+}
+
+/**
+ * Raccorde les fragments en une seule tournée : depuis l'extrémité courante,
+ * on rejoint l'extrémité libre la plus proche d'un autre fragment.
+ * Faux si l'allocation échoue.
+ */
+static bool raccorder_fragments(const InstanceTSP* instance, FonctionDistance dist_func,
+                                int* adjacence, int* degre) {
+    int n = instance->dimension;
+    int* extremite = (int*)malloc(n * sizeof(int));
+    bool* libre = (bool*)calloc(n, sizeof(bool));
+    int* liste_libres = (int*)malloc(n * sizeof(int));
+    if (!extremite || !libre || !liste_libres) {
+        free(extremite);
+        free(libre);
+        free(liste_libres);
+        return false;
+    }
+    int nb_libres = 0;
+
+    for (int v = 0; v < n; v++) {
+        extremite[v] = -1;
+        if (degre[v] < 2) {
+            libre[v] = true;
+            liste_libres[nb_libres++] = v;
+        }
+    }
+    for (int i = 0; i < nb_libres; i++) {
+        int v = liste_libres[i];
+        if (extremite[v] == -1) {
+            int w = autre_extremite(adjacence, degre, v);
+            extremite[v] = w;
+            extremite[w] = v;
+        }
+    }
+
+    // Grille restreinte aux extrémités libres (distances planaires uniquement)
+    GrilleVilles* grille = NULL;
+    if (distance_planaire(instance->type_distance)) {
+        grille = creer_grille(instance, 2);
+        if (grille) {
+            for (int v = 0; v < n; v++) {
+                if (!libre[v]) grille_retirer_ville(grille, v);
+            }
+        }
+    }
+
+    int depart = liste_libres[0];
+    int courante = extremite[depart];
+    libre[depart] = libre[courante] = false;
+    if (grille) {
+        grille_retirer_ville(grille, depart);
+        grille_retirer_ville(grille, courante);
+    }
+
+    while (true) {
+        int proche = -1;
+        if (grille) {
+            proche = grille_plus_proche(grille, instance, dist_func, courante);
+        } else {
+            double distance_min = 0.0;
+            for (int i = 0; i < nb_libres; i++) {
+                int v = liste_libres[i];
+                if (!libre[v]) continue;
+                double dist = distance_villes(instance, dist_func, courante, v);
+                if (proche == -1 || dist < distance_min) {
+                    distance_min = dist;
+                    proche = v;
+                }
+            }
+        }
+        if (proche == -1) break;
+
+        int bout = extremite[proche];
+        ajouter_arete(adjacence, degre, courante, proche);
+        libre[proche] = libre[bout] = false;
+        if (grille) {
+            grille_retirer_ville(grille, proche);
+            grille_retirer_ville(grille, bout);
+        }
+        courante = bout;
+    }
+
+    // Fermer la tournée
+    if (courante != depart) {
+        ajouter_arete(adjacence, degre, courante, depart);
+    }
+
+    liberer_grille(grille);
+    free(extremite);
+    free(libre);
+    free(liste_libres);
+    return true;
+}
+
+/**
+ * Construction gloutonne : les arêtes candidates (k plus proches voisins) sont
+ * triées par longueur et ajoutées tant que les deux extrémités ont un degré < 2
+ * et que l'arête ne ferme pas de cycle. Les fragments obtenus sont ensuite raccordés.
+ * Complexité O(n log n) pour EUCL_2D/ATT (grille), O(n²) sinon.
+ */
+Tournee* glouton_aretes(const InstanceTSP* instance, FonctionDistance dist_func) {
+    int n = instance->dimension;
+    Tournee* tournee = creer_tournee(n);
+    if (!tournee) return NULL;
+
+    if (n < 3) {
+        for (int i = 0; i < n; i++) tournee->chemin[i] = i + 1;
+        calculer_longueur_tournee(tournee, instance, dist_func);
+        return tournee;
+    }
+
+    ListesCandidats* candidats = calculer_candidats(instance, dist_func, NB_CANDIDATS_DEFAUT);
+    if (!candidats) {
+        liberer_tournee(tournee);
+        return NULL;
+    }
+    int k = candidats->k;
+
+    AreteCandidate* aretes = (AreteCandidate*)malloc((size_t)n * k * sizeof(AreteCandidate));
+    int* adjacence = (int*)malloc(2 * n * sizeof(int));
+    int* degre = (int*)calloc(n, sizeof(int));
+    int* parent = (int*)malloc(n * sizeof(int));
+    int* rang = (int*)calloc(n, sizeof(int));
+    if (!aretes || !adjacence || !degre || !parent || !rang) {
+        free(aretes); free(adjacence); free(degre); free(parent); free(rang);
+        liberer_candidats(candidats);
+        liberer_tournee(tournee);
+        return NULL;
+    }
+
+    // Arêtes (i, j) avec i < j issues des listes de candidats
+    int nb_aretes = 0;
+    for (int i = 0; i < n; i++) {
+        for (int r = 0; r < k; r++) {
+            int j = candidats->voisins[(size_t)i * k + r];
+            aretes[nb_aretes].ville1 = i < j ? i : j;
+            aretes[nb_aretes].ville2 = i < j ? j : i;
+            aretes[nb_aretes].distance = distance_villes(instance, dist_func, i, j);
+            nb_aretes++;
+        }
+    }
+    for (int v = 0; v < n; v++) parent[v] = v;
+
+    int nb_choisies = selection_gloutonne(aretes, nb_aretes, n - 1,
+                                          adjacence, degre, parent, rang);
+
+    // Les fragments restants sont reliés par de nouvelles passes sur leurs extrémités,
+    // puis par le plus proche voisin si nécessaire
+    nb_choisies += passes_extremites(instance, dist_func, adjacence, degre, parent, rang,
+                                     n - 1 - nb_choisies);
+    bool ok = raccorder_fragments(instance, dist_func, adjacence, degre);
+
+    // Parcourir le cycle à partir de la ville 1
+    int precedente = -1, courante = 0;
+    for (int pos = 0; ok && pos < n; pos++) {
+        tournee->chemin[pos] = courante + 1;
+        int suivante = adjacence[2 * courante] != precedente ? adjacence[2 * courante]
+                                                              : adjacence[2 * courante + 1];
+        precedente = courante;
+        courante = suivante;
+    }
+
+    free(aretes);
+    free(adjacence);
+    free(degre);
+    free(parent);
+    free(rang);
+    liberer_candidats(candidats);
+    if (!ok) {
+        liberer_tournee(tournee);
+        return NULL;
+    }
+    calculer_longueur_tournee(tournee, instance, dist_func);
+    return tournee;
+}
@@ -0,0 +1,269 @@
+/**
+ * grille.c
+ * Grille uniforme pour la recherche du plus proche voisin non visité
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <math.h>
+#include <stdbool.h>
+
+#include "grille.h"
+
+static int indice_colonne(const GrilleVilles* grille, double x) {
+    int c = (int)((x - grille->x_min) / grille->taille_cellule);
+    if (c < 0) c = 0;
+    if (c >= grille->nb_colonnes) c = grille->nb_colonnes - 1;
+    return c;
+}
+
+static int indice_ligne(const GrilleVilles* grille, double y) {
+    int l = (int)((y - grille->y_min) / grille->taille_cellule);
+    if (l < 0) l = 0;
+    if (l >= grille->nb_lignes) l = grille->nb_lignes - 1;
+    return l;
+}
+
+GrilleVilles* creer_grille(const InstanceTSP* instance, int villes_par_cellule) {
+    int n = instance->dimension;
+    if (n <= 0 || !instance->villes) return NULL;
+    if (villes_par_cellule < 1) villes_par_cellule = 1;
+
+    GrilleVilles* grille = (GrilleVilles*)calloc(1, sizeof(GrilleVilles));
+    if (!grille) return NULL;
+
+    // Boîte englobante
+    double x_min = instance->villes[0].x, x_max = x_min;
+    double y_min = instance->villes[0].y, y_max = y_min;
+    for (int i = 1; i < n; i++) {
+        if (instance->villes[i].x < x_min) x_min = instance->villes[i].x;
+        if (instance->villes[i].x > x_max) x_max = instance->villes[i].x;
+        if (instance->villes[i].y < y_min) y_min = instance->villes[i].y;
+        if (instance->villes[i].y > y_max) y_max = instance->villes[i].y;
+    }
+    double largeur = x_max - x_min;
+    double hauteur = y_max - y_min;
+
+    // Cellules carrées, environ n / villes_par_cellule cellules au total
+    int nb_cellules_vise = n / villes_par_cellule;
+    if (nb_cellules_vise < 1) nb_cellules_vise = 1;
+    double cote = largeur > hauteur ? largeur : hauteur;
+    if (largeur > 0.0 && hauteur > 0.0) {
+        cote = sqrt(largeur * hauteur / nb_cellules_vise);
+    } else if (cote > 0.0) {
+        cote = cote / nb_cellules_vise;
+    } else {
+        cote = 1.0; // Toutes les villes au même point
+    }
+
+    grille->x_min = x_min;
+    grille->y_min = y_min;
+    grille->taille_cellule = cote;
+    grille->nb_colonnes = (int)(largeur / cote) + 1;
+    grille->nb_lignes = (int)(hauteur / cote) + 1;
+    int nb_cellules = grille->nb_colonnes * grille->nb_lignes;
+
+    grille->debut_cellule = (int*)calloc(nb_cellules + 1, sizeof(int));
+    grille->nb_actives = (int*)calloc(nb_cellules, sizeof(int));
+    grille->villes = (int*)malloc(n * sizeof(int));
+    grille->position = (int*)malloc(n * sizeof(int));
+    grille->cellule = (int*)malloc(n * sizeof(int));
+    if (!grille->debut_cellule || !grille->nb_actives || !grille->villes
+        || !grille->position || !grille->cellule) {
+        liberer_grille(grille);
+        return NULL;
+    }
+
+    // Tri par dénombrement des villes selon leur cellule
+    for (int i = 0; i < n; i++) {
+        int c = indice_ligne(grille, instance->villes[i].y) * grille->nb_colonnes
+              + indice_colonne(grille, instance->villes[i].x);
+        grille->cellule[i] = c;
+        grille->nb_actives[c]++;
+    }
+    for (int c = 0; c < nb_cellules; c++) {
+        grille->debut_cellule[c + 1] = grille->debut_cellule[c] + grille->nb_actives[c];
+        grille->nb_actives[c] = 0;
+    }
+    for (int i = 0; i < n; i++) {
+        int c = grille->cellule[i];
+        int pos = grille->debut_cellule[c] + grille->nb_actives[c]++;
+        grille->villes[pos] = i;
+        grille->position[i] = pos;
+    }
+    grille->nb_villes_actives = n;
+
+    return grille;
+}
+
+void liberer_grille(GrilleVilles* grille) {
+    if (grille) {
+        free(grille->debut_cellule);
+        free(grille->nb_actives);
+        free(grille->villes);
+        free(grille->position);
+        free(grille->cellule);
+        free(grille);
+    }
+}
+
+void grille_retirer_ville(GrilleVilles* grille, int v) {
+    int c = grille->cellule[v];
+    int pos = grille->position[v];
+    int dernier = grille->debut_cellule[c] + grille->nb_actives[c] - 1;
+    if (pos > dernier) return; // Déjà retirée
+
+    // Échanger avec la dernière ville active de la cellule
+    int autre = grille->villes[dernier];
+    grille->villes[dernier] = v;
+    grille->villes[pos] = autre;
+    grille->position[autre] = pos;
+    grille->position[v] = dernier;
+    grille->nb_actives[c]--;
+    grille->nb_villes_actives--;
+}
+
+// Distance minimale de (px, py) à un point situé hors du bloc de cellules
+// [cx - r, cx + r] x [cy - r, cy + r]
+static double borne_hors_anneaux(const GrilleVilles* grille, double px, double py,
+                                 int cx, int cy, int r) {
+    double gauche = px - (grille->x_min + (cx - r) * grille->taille_cellule);
+    double droite = grille->x_min + (cx + r + 1) * grille->taille_cellule - px;
+    double bas = py - (grille->y_min + (cy - r) * grille->taille_cellule);
+    double haut = grille->y_min + (cy + r + 1) * grille->taille_cellule - py;
+    double borne = gauche;
+    if (droite < borne) borne = droite;
+    if (bas < borne) borne = bas;
+    if (haut < borne) borne = haut;
+    return borne;
+}
+
+int grille_plus_proche(const GrilleVilles* grille, const InstanceTSP* instance,
+                       FonctionDistance dist_func, int v) {
+    if (grille->nb_villes_actives == 0) return -1;
+
+    double px = instance->villes[v].x;
+    double py = instance->villes[v].y;
+    int cx = indice_colonne(grille, px);
+    int cy = indice_ligne(grille, py);
+    int rayon_max = grille->nb_colonnes > grille->nb_lignes ? grille->nb_colonnes : grille->nb_lignes;
+
+    const Ville* depart = &instance->villes[v];
+    double distance_min = DBL_MAX;
+    int ville_proche = -1;
+
+    // Parcours en anneaux concentriques autour de la cellule de v
+    for (int r = 0; r <= rayon_max; r++) {
+        for (int ly = cy - r; ly <= cy + r; ly++) {
+            if (ly < 0 || ly >= grille->nb_lignes) continue;
+            // Sur les lignes intérieures, seules les deux colonnes du bord appartiennent à l'anneau
+            int pas = (ly == cy - r || ly == cy + r) ? 1 : 2 * r;
+            if (pas == 0) pas = 1;
+            for (int lx = cx - r; lx <= cx + r; lx += pas) {
+                if (lx < 0 || lx >= grille->nb_colonnes) continue;
+                int c = ly * grille->nb_colonnes + lx;
+                int debut = grille->debut_cellule[c];
+                int fin = debut + grille->nb_actives[c];
+                for (int k = debut; k < fin; k++) {
+                    int w = grille->villes[k];
+                    double dist = dist_func(depart, &instance->villes[w]);
+                    if (dist < distance_min || (dist == distance_min && w < ville_proche)) {
+                        distance_min = dist;
+                        ville_proche = w;
+                    }
+                }
+            }
+        }
+
+        // Distance minimale de v à une ville située hors des anneaux déjà parcourus
+        if (ville_proche != -1) {
+            double borne = borne_hors_anneaux(grille, px, py, cx, cy, r);
+            // La distance ne dépend que de l'écart euclidien : on l'évalue sur un point fictif
+            Ville limite = { 0, px + borne, py };
+            if (borne > 0.0 && dist_func(depart, &limite) > distance_min) break;
+        }
+    }
+
+    return ville_proche;
+}
+
+
+// Vrai si w est dans le quadrant q (0 à 3, sens trigonométrique) autour de v ; q = -1 : toujours
+static bool dans_quadrant(const InstanceTSP* instance, int v, int w, int q) {
+    double dx = instance->villes[w].x - instance->villes[v].x;
+    double dy = instance->villes[w].y - instance->villes[v].y;
+    switch (q) {
+        case 0: return dx > 0.0 && dy >= 0.0;
+        case 1: return dx <= 0.0 && dy > 0.0;
+        case 2: return dx < 0.0 && dy <= 0.0;
+        case 3: return dx >= 0.0 && dy < 0.0;
+        default: return true;
+    }
+}
+
+static int k_plus_proches_quadrant(const GrilleVilles* grille, const InstanceTSP* instance,
+                                   FonctionDistance dist_func, int v, int k, int quadrant,
+                                   int* voisins, double* distances) {
+    double px = instance->villes[v].x;
+    double py = instance->villes[v].y;
+    int cx = indice_colonne(grille, px);
+    int cy = indice_ligne(grille, py);
+    int rayon_max = grille->nb_colonnes > grille->nb_lignes ? grille->nb_colonnes : grille->nb_lignes;
+
+    const Ville* depart = &instance->villes[v];
+    int nb = 0;
+
+    for (int r = 0; r <= rayon_max; r++) {
+        for (int ly = cy - r; ly <= cy + r; ly++) {
+            if (ly < 0 || ly >= grille->nb_lignes) continue;
+            int pas = (ly == cy - r || ly == cy + r) ? 1 : 2 * r;
+            if (pas == 0) pas = 1;
+            for (int lx = cx - r; lx <= cx + r; lx += pas) {
+                if (lx < 0 || lx >= grille->nb_colonnes) continue;
+                int c = ly * grille->nb_colonnes + lx;
+                int debut = grille->debut_cellule[c];
+                int fin = debut + grille->nb_actives[c];
+                for (int p = debut; p < fin; p++) {
+                    int w = grille->villes[p];
+                    if (w == v || !dans_quadrant(instance, v, w, quadrant)) continue;
+                    double dist = dist_func(depart, &instance->villes[w]);
+
+                    // Insertion triée (distance puis indice) dans les k meilleurs
+                    if (nb == k && (dist > distances[k - 1]
+                                    || (dist == distances[k - 1] && w > voisins[k - 1]))) {
+                        continue;
+                    }
+                    int pos = (nb < k) ? nb++ : k - 1;
+                    while (pos > 0 && (distances[pos - 1] > dist
+                                       || (distances[pos - 1] == dist && voisins[pos - 1] > w))) {
+                        distances[pos] = distances[pos - 1];
+                        voisins[pos] = voisins[pos - 1];
+                        pos--;
+                    }
+                    distances[pos] = dist;
+                    voisins[pos] = w;
+                }
+            }
+        }
+
+        if (nb == k) {
+            double borne = borne_hors_anneaux(grille, px, py, cx, cy, r);
+            Ville limite = { 0, px + borne, py };
+            if (borne > 0.0 && dist_func(depart, &limite) > distances[k - 1]) break;
+        }
+    }
+
+    return nb;
+}
+int grille_k_plus_proches(const GrilleVilles* grille, const InstanceTSP* instance,
+                          FonctionDistance dist_func, int v, int k,
+                          int* voisins, double* distances) {
+    return k_plus_proches_quadrant(grille, instance, dist_func, v, k, -1, voisins, distances);
+}
+
+int grille_k_plus_proches_quadrant(const GrilleVilles* grille, const InstanceTSP* instance,
+                                   FonctionDistance dist_func, int v, int k, int quadrant,
+                                   int* voisins, double* distances) {
+    return k_plus_proches_quadrant(grille, instance, dist_func, v, k, quadrant, voisins, distances);
+}
@@ -0,0 +1,48 @@
+#ifndef GRILLE_H
+#define GRILLE_H
+
+#include "tsp.h"
+
+// Grille uniforme de villes (recherche du plus proche voisin avec suppression)
+// Les villes de chaque cellule sont rangées de façon contiguë dans 'villes' :
+// les 'nb_actives[c]' premières sont encore présentes, les suivantes ont été retirées.
+typedef struct {
+    int nb_colonnes;
+    int nb_lignes;
+    double x_min;
+    double y_min;
+    double taille_cellule;
+    int* debut_cellule;     // Début de chaque cellule dans 'villes' (nb_cellules + 1 entrées)
+    int* nb_actives;        // Nombre de villes encore présentes par cellule
+    int* villes;            // Indices (0-based) des villes, regroupés par cellule
+    int* position;          // Position de chaque ville dans 'villes'
+    int* cellule;           // Cellule de chaque ville
+    int nb_villes_actives;
+} GrilleVilles;
+
+// Construit la grille avec environ 'villes_par_cellule' villes par cellule
+GrilleVilles* creer_grille(const InstanceTSP* instance, int villes_par_cellule);
+
+void liberer_grille(GrilleVilles* grille);
+
+// Retire la ville v (0-based) de la grille en O(1)
+void grille_retirer_ville(GrilleVilles* grille, int v);
+
+// Retourne la ville active la plus proche de v (0-based), -1 si la grille est vide.
+// À distance égale, la ville de plus petit indice est choisie. La distance doit
+// être une fonction croissante de la distance euclidienne (voir distance_planaire).
+int grille_plus_proche(const GrilleVilles* grille, const InstanceTSP* instance,
+                       FonctionDistance dist_func, int v);
+
+// Remplit 'voisins' et 'distances' avec les k villes actives les plus proches de v
+// (v exclue), triées par distance croissante. Retourne le nombre de villes trouvées.
+int grille_k_plus_proches(const GrilleVilles* grille, const InstanceTSP* instance,
+                          FonctionDistance dist_func, int v, int k,
+                          int* voisins, double* distances);
+
+// Idem, restreint aux villes du quadrant 'quadrant' (0 à 3, sens trigonométrique) autour de v
+int grille_k_plus_proches_quadrant(const GrilleVilles* grille, const InstanceTSP* instance,
+                                   FonctionDistance dist_func, int v, int k, int quadrant,
+                                   int* voisins, double* distances);
+
+#endif
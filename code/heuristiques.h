@@ -3,13 +3,37 @@
 
 #include <stdbool.h>
 #include "tsp.h"
+#include "alea.h"
 
 //          ALGORITHMES HEURISTIQUES
 
 Tournee* plus_proche_voisin(const InstanceTSP* instance, FonctionDistance dist_func);
 
-Tournee* marche_aleatoire(const InstanceTSP* instance, FonctionDistance dist_func);
+// Plus proche voisin à partir de la ville 'depart' (0-indexée)
+Tournee* plus_proche_voisin_depuis(const InstanceTSP* instance, FonctionDistance dist_func, int depart);
 
+// Plus proche voisin accéléré par une grille uniforme (EUCL_2D et ATT)
+Tournee* plus_proche_voisin_grille(const InstanceTSP* instance, FonctionDistance dist_func);
+Tournee* plus_proche_voisin_grille_depuis(const InstanceTSP* instance, FonctionDistance dist_func,
+                                          int depart);
+
+// Heuristique gloutonne sur les arêtes des listes de candidats (union-find)
+Tournee* glouton_aretes(const InstanceTSP* instance, FonctionDistance dist_func);
+
+// Arbre couvrant minimal + couplage glouton des sommets impairs + circuit eulérien raccourci
+Tournee* construction_arbre_couvrant(const InstanceTSP* instance, FonctionDistance dist_func);
+
+// Graine par défaut de rw et 2optrw (résultats reproductibles)
+#define GRAINE_MARCHE_ALEATOIRE 1
+
+// Marche aléatoire reproductible (permutation de Fisher-Yates, générateur 'alea')
+Tournee* marche_aleatoire(const InstanceTSP* instance, FonctionDistance dist_func, Alea* alea);
+
+// 2-opt première amélioration ; s'arrête à l'échéance du thread (chrono.h)
 void deux_opt(Tournee* tournee, const InstanceTSP* instance, FonctionDistance dist_func);
 
+// 2-opt par lots de meilleurs mouvements indépendants, voisinage évalué sur nb_threads threads
+void deux_opt_parallele(Tournee* tournee, const InstanceTSP* instance,
+                        FonctionDistance dist_func, int nb_threads);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,142 @@
+/**
+ * hilbert.c
+ * Courbe de Hilbert : construction de tournée et renumérotation des villes
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "hilbert.h"
+#include "tsp_utils.h"
+#include "matrice.h"
+#include "parser.h"
+#include "instance_binaire.h"
+
+#define ORDRE_HILBERT 16   // Grille de 2^16 x 2^16 points
+
+typedef struct {
+    uint64_t cle;
+    int ville;
+} CleHilbert;
+
+// Position du point (x, y) le long de la courbe de Hilbert d'ordre ORDRE_HILBERT
+static uint64_t indice_hilbert(uint32_t x, uint32_t y) {
+    uint64_t d = 0;
+    for (uint32_t s = 1u << (ORDRE_HILBERT - 1); s > 0; s >>= 1) {
+        uint32_t rx = (x & s) ? 1 : 0;
+        uint32_t ry = (y & s) ? 1 : 0;
+        d += (uint64_t)s * s * ((3 * rx) ^ ry);
+        // Rotation du quadrant
+        if (ry == 0) {
+            if (rx == 1) {
+                x = (s - 1) - (x & (s - 1));
+                y = (s - 1) - (y & (s - 1));
+            }
+            uint32_t t = x;
+            x = y;
+            y = t;
+        }
+    }
+    return d;
+}
+
+static int comparer_cles(const void* a, const void* b) {
+    const CleHilbert* c1 = (const CleHilbert*)a;
+    const CleHilbert* c2 = (const CleHilbert*)b;
+    if (c1->cle < c2->cle) return -1;
+    if (c1->cle > c2->cle) return 1;
+    return c1->ville - c2->ville;
+}
+
+int* ordre_hilbert(const InstanceTSP* instance) {
+    int n = instance->dimension;
+    CleHilbert* cles = (CleHilbert*)malloc(n * sizeof(CleHilbert));
+    int* ordre = (int*)malloc(n * sizeof(int));
+    if (!cles || !ordre) {
+        free(cles);
+        free(ordre);
+        return NULL;
+    }
+
+    // Boîte englobante, même échelle sur les deux axes
+    double x_min = instance->villes[0].x, x_max = x_min;
+    double y_min = instance->villes[0].y, y_max = y_min;
+    for (int i = 1; i < n; i++) {
+        if (instance->villes[i].x < x_min) x_min = instance->villes[i].x;
+        if (instance->villes[i].x > x_max) x_max = instance->villes[i].x;
+        if (instance->villes[i].y < y_min) y_min = instance->villes[i].y;
+        if (instance->villes[i].y > y_max) y_max = instance->villes[i].y;
+    }
+    double etendue = (x_max - x_min) > (y_max - y_min) ? (x_max - x_min) : (y_max - y_min);
+    double echelle = etendue > 0.0 ? ((1u << ORDRE_HILBERT) - 1) / etendue : 0.0;
+
+    for (int i = 0; i < n; i++) {
+        uint32_t x = (uint32_t)((instance->villes[i].x - x_min) * echelle);
+        uint32_t y = (uint32_t)((instance->villes[i].y - y_min) * echelle);
+        cles[i].cle = indice_hilbert(x, y);
+        cles[i].ville = i;
+    }
+    qsort(cles, n, sizeof(CleHilbert), comparer_cles);
+
+    for (int i = 0; i < n; i++) {
+        ordre[i] = cles[i].ville;
+    }
+    free(cles);
+    return ordre;
+}
+
+Tournee* courbe_hilbert(const InstanceTSP* instance, FonctionDistance dist_func) {
+    int n = instance->dimension;
+    Tournee* tournee = creer_tournee(n);
+    if (!tournee) return NULL;
+
+    int* ordre = ordre_hilbert(instance);
+    if (!ordre) {
+        liberer_tournee(tournee);
+        return NULL;
+    }
+
+    // Faire commencer la tournée à la ville 1
+    int debut = 0;
+    for (int i = 0; i < n; i++) {
+        if (ordre[i] == 0) {
+            debut = i;
+            break;
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        tournee->chemin[i] = ordre[(debut + i) % n] + 1;
+    }
+
+    calculer_longueur_tournee(tournee, instance, dist_func);
+
+    free(ordre);
+    return tournee;
+}
+
+void renumeroter_villes_hilbert(InstanceTSP* instance) {
+    int n = instance->dimension;
+    int* ordre = ordre_hilbert(instance);
+    Ville* villes = (Ville*)malloc(n * sizeof(Ville));
+    if (!ordre || !villes) {
+        free(ordre);
+        free(villes);
+        return;
+    }
+
+    for (int i = 0; i < n; i++) {
+        villes[i] = instance->villes[ordre[i]];
+    }
+    if (!instance_binaire_contient(instance, instance->villes)) {
+        free(instance->villes);
+    }
+    instance->villes = villes;
+
+    // Matrice et candidats d'une instance binaire : dans l'ancienne numérotation
+    liberer_matrice_distances(instance);
+    retirer_candidats_instance(instance);
+    instance->borne_inferieure = 0.0;
+
+    free(ordre);
+}
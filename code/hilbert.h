@@ -0,0 +1,17 @@
+#ifndef HILBERT_H
+#define HILBERT_H
+
+#include "tsp.h"
+
+// Retourne les indices (0-based) des villes triés selon la courbe de Hilbert
+// (tableau de taille dimension à libérer par l'appelant)
+int* ordre_hilbert(const InstanceTSP* instance);
+
+// Construction : visite les villes dans l'ordre de la courbe de Hilbert, O(n log n)
+Tournee* courbe_hilbert(const InstanceTSP* instance, FonctionDistance dist_func);
+
+// Réordonne instance->villes selon la courbe de Hilbert (avant le calcul de la matrice).
+// Les numéros TSPLIB d'origine restent dans villes[i].numero.
+void renumeroter_villes_hilbert(InstanceTSP* instance);
+
+#endif
@@ -0,0 +1,111 @@
+/**
+ * ils.c
+ * Recherche locale itérée : double-bridge local, réoptimisation autour des
+ * villes touchées (don't-look bits), acceptation si amélioration
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <signal.h>
+
+#include "ils.h"
+#include "tsp_utils.h"
+#include "matrice.h"
+#include "candidats.h"
+#include "tournee_tableau.h"
+#include "recherche_locale.h"
+#include "alea.h"
+#include "chrono.h"
+
+static volatile sig_atomic_t interruption_ils = 0;
+
+void ils_interruption(int sig) {
+    (void)sig;
+    interruption_ils = 1;
+}
+
+void ils_armer_interruption(void) {
+    interruption_ils = 0;
+}
+
+void params_ils_defaut(ParamsILS* params) {
+    params->nb_perturbations = 0;
+    params->longueur_max_segment = 50;
+    params->graine = 2025;
+}
+
+void recherche_locale_iteree(Tournee* tournee, const InstanceTSP* instance,
+                             FonctionDistance dist_func, const ParamsILS* params) {
+    int n = instance->dimension;
+    if (!tournee || n < 8) return;
+
+    ListesCandidats* candidats = candidats_recherche_locale(instance, dist_func);
+    TourneeTableau* t = creer_tournee_tableau(tournee);
+    RechercheLocale* recherche = candidats && t
+                               ? creer_recherche_locale(instance, dist_func, candidats, t) : NULL;
+    if (!recherche) {
+        liberer_candidats(candidats);
+        liberer_tournee_tableau(t);
+        return;
+    }
+
+    // Optimum local de départ
+    recherche_locale_activer_tout(recherche);
+    recherche_locale_optimiser(recherche);
+
+    Alea alea;
+    alea_initialiser(&alea, params->graine);
+    long long nb_perturbations = params->nb_perturbations > 0 ? params->nb_perturbations : n;
+    int l_max = params->longueur_max_segment;
+    if (2 * l_max > n - 2) l_max = (n - 2) / 2;
+
+    for (long long it = 0; it < nb_perturbations && !interruption_ils; it++) {
+        if ((it & 15) == 0 && echeance_atteinte()) break;
+
+        // Double-bridge : échange de deux segments consécutifs courts ]i, j] et ]j, k]
+        int i = alea_entier(&alea, n);
+        int j = (i + 1 + alea_entier(&alea, l_max)) % n;
+        int k = (j + 1 + alea_entier(&alea, l_max)) % n;
+        int a = t->ordre[i], a2 = t->ordre[(i + 1) % n];
+        int b = t->ordre[j], b2 = t->ordre[(j + 1) % n];
+        int c = t->ordre[k], c2 = t->ordre[(k + 1) % n];
+        double delta = distance_villes(instance, dist_func, a, b2)
+                     + distance_villes(instance, dist_func, c, a2)
+                     + distance_villes(instance, dist_func, b, c2)
+                     - distance_villes(instance, dist_func, a, a2)
+                     - distance_villes(instance, dist_func, b, b2)
+                     - distance_villes(instance, dist_func, c, c2);
+
+        tableau_journal_debut(t);
+        tableau_echanger_segments(t, i, j, k);
+
+        // Seules les extrémités des arêtes modifiées sont réexaminées
+        recherche_locale_activer(recherche, a);
+        recherche_locale_activer(recherche, a2);
+        recherche_locale_activer(recherche, b);
+        recherche_locale_activer(recherche, b2);
+        recherche_locale_activer(recherche, c);
+        recherche_locale_activer(recherche, c2);
+        double gain = recherche_locale_optimiser(recherche);
+
+        if (t->erreur_journal) {
+            // Retour à la dernière tournée acceptée
+            tableau_journal_annuler(t);
+            fprintf(stderr, "Erreur: Allocation du journal de la tournée, recherche arrêtée\n");
+            break;
+        }
+        if (gain - delta > 1e-9) tableau_journal_valider(t);
+        else tableau_journal_annuler(t);
+    }
+    t->journal_actif = false;
+
+    if (interruption_ils) {
+        printf("\nRecherche interrompue : meilleure tournée trouvée jusqu'à présent.\n");
+    }
+    tableau_vers_tournee(t, tournee);
+    calculer_longueur_tournee(tournee, instance, dist_func);
+
+    liberer_recherche_locale(recherche);
+    liberer_tournee_tableau(t);
+    liberer_candidats(candidats);
+}
@@ -0,0 +1,29 @@
+#ifndef ILS_H
+#define ILS_H
+
+#include <stdint.h>
+#include "tsp.h"
+
+// Paramètres de la recherche locale itérée
+typedef struct {
+    long long nb_perturbations;     // Nombre de double-bridges (<= 0 : n)
+    int longueur_max_segment;       // Longueur maximale des deux segments échangés
+    uint64_t graine;
+} ParamsILS;
+
+void params_ils_defaut(ParamsILS* params);
+
+// Recherche locale itérée à partir de 'tournee', remplacée par la meilleure tournée.
+// S'arrête après nb_perturbations, à l'échéance du thread (chrono.h) ou à la
+// réception de SIGINT (ils_interruption).
+void recherche_locale_iteree(Tournee* tournee, const InstanceTSP* instance,
+                             FonctionDistance dist_func, const ParamsILS* params);
+
+// Gestionnaire de signal pour SIGINT (Ctrl+C) : termine les recherches en cours.
+// Le drapeau n'est que lu par recherche_locale_iteree (appelée en parallèle par
+// decomp, portfolio et le serveur) : ils_armer_interruption le remet à zéro,
+// une fois, là où le gestionnaire est installé.
+void ils_interruption(int sig);
+void ils_armer_interruption(void);
+
+#endif
@@ -0,0 +1,264 @@
+/**
+ * instance_binaire.c
+ * Instances binaires projetées en mémoire (villes, matrice, candidats)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "instance_binaire.h"
+#include "candidats.h"
+
+#define SIGNATURE_BINAIRE "TSPBINAI"
+#define VERSION_BINAIRE 1
+#define BOUTISME_NATIF 0x01020304u
+
+// Chaque section commence au début d'une page
+#define ALIGNEMENT_SECTION 4096
+
+typedef struct {
+    char signature[8];
+    uint32_t version;
+    uint32_t boutisme;              // BOUTISME_NATIF dans l'ordre des octets de l'écrivain
+    uint32_t taille_ville;          // sizeof(Ville) de l'écrivain
+    uint32_t type_distance;
+    int32_t dimension;
+    int32_t k_candidats;            // 0 : pas de candidats
+    double borne_inferieure;
+    uint64_t decalage_villes;
+    uint64_t decalage_matrice;      // 0 : pas de matrice
+    uint64_t decalage_candidats;    // 0 : pas de candidats
+    uint64_t taille_fichier;
+    char nom[NOM_MAX];
+    char commentaire[COMMENTAIRE_MAX];
+} EnTeteBinaire;
+
+static uint64_t aligner(uint64_t decalage) {
+    return (decalage + ALIGNEMENT_SECTION - 1) / ALIGNEMENT_SECTION * ALIGNEMENT_SECTION;
+}
+
+static uint64_t taille_matrice(int n) {
+    return n > 1 ? (uint64_t)n * (uint64_t)(n - 1) / 2 * sizeof(double) : 0;
+}
+
+bool est_instance_binaire(const char* nomFichier) {
+    char signature[8];
+    FILE* f = fopen(nomFichier, "rb");
+    if (!f) return false;
+    bool binaire = fread(signature, 1, sizeof(signature), f) == sizeof(signature)
+                && memcmp(signature, SIGNATURE_BINAIRE, sizeof(signature)) == 0;
+    fclose(f);
+    return binaire;
+}
+
+bool instance_binaire_contient(const InstanceTSP* instance, const void* adresse) {
+    const char* debut = (const char*)instance->projection;
+    const char* p = (const char*)adresse;
+    return debut && p >= debut && p < debut + instance->taille_projection;
+}
+
+// Bourrage jusqu'au décalage 'cible'
+static bool completer(FILE* f, uint64_t* position, uint64_t cible) {
+    static const char zeros[ALIGNEMENT_SECTION];
+    while (*position < cible) {
+        size_t morceau = (size_t)(cible - *position);
+        if (morceau > sizeof(zeros)) morceau = sizeof(zeros);
+        if (fwrite(zeros, 1, morceau, f) != morceau) return false;
+        *position += morceau;
+    }
+    return true;
+}
+
+static bool ecrire_section(FILE* f, uint64_t* position, uint64_t decalage,
+                           const void* donnees, uint64_t taille) {
+    if (!completer(f, position, decalage)) return false;
+    if (taille && fwrite(donnees, 1, (size_t)taille, f) != taille) return false;
+    *position += taille;
+    return true;
+}
+
+bool sauvegarder_instance_binaire(const InstanceTSP* instance, const char* nomFichier) {
+    int n = instance->dimension;
+    const ListesCandidats* candidats = instance->candidats;
+    bool avec_matrice = instance->matrice_existe && n > 1;
+
+    EnTeteBinaire entete;
+    memset(&entete, 0, sizeof(entete));
+    memcpy(entete.signature, SIGNATURE_BINAIRE, sizeof(entete.signature));
+    entete.version = VERSION_BINAIRE;
+    entete.boutisme = BOUTISME_NATIF;
+    entete.taille_ville = sizeof(Ville);
+    entete.type_distance = (uint32_t)instance->type_distance;
+    entete.dimension = n;
+    entete.k_candidats = candidats ? candidats->k : 0;
+    entete.borne_inferieure = instance->borne_inferieure;
+    snprintf(entete.nom, sizeof(entete.nom), "%s", instance->nom);
+    snprintf(entete.commentaire, sizeof(entete.commentaire), "%s", instance->commentaire);
+
+    uint64_t fin = aligner(sizeof(EnTeteBinaire));
+    entete.decalage_villes = fin;
+    fin += (uint64_t)n * sizeof(Ville);
+    if (avec_matrice) {
+        entete.decalage_matrice = aligner(fin);
+        fin = entete.decalage_matrice + taille_matrice(n);
+    }
+    if (candidats) {
+        entete.decalage_candidats = aligner(fin);
+        fin = entete.decalage_candidats + (uint64_t)n * candidats->k * sizeof(int);
+    }
+    entete.taille_fichier = fin;
+
+    char temporaire[4096];
+    snprintf(temporaire, sizeof(temporaire), "%s.tmp", nomFichier);
+    FILE* f = fopen(temporaire, "wb");
+    if (!f) {
+        perror("Erreur écriture instance binaire");
+        return false;
+    }
+    uint64_t position = 0;
+    bool ok = ecrire_section(f, &position, 0, &entete, sizeof(entete))
+           && ecrire_section(f, &position, entete.decalage_villes, instance->villes,
+                             (uint64_t)n * sizeof(Ville));
+    // Le bloc contigu de la matrice commence à la ligne 1 (matrice.c)
+    if (ok && avec_matrice) {
+        ok = ecrire_section(f, &position, entete.decalage_matrice, instance->matrice_distances[1],
+                            taille_matrice(n));
+    }
+    if (ok && candidats) {
+        ok = ecrire_section(f, &position, entete.decalage_candidats, candidats->voisins,
+                            (uint64_t)n * candidats->k * sizeof(int));
+    }
+    ok = (fclose(f) == 0) && ok;
+    if (ok && rename(temporaire, nomFichier) != 0) ok = false;
+    if (!ok) {
+        perror("Erreur écriture instance binaire");
+        remove(temporaire);
+    }
+    return ok;
+}
+
+/*  Section de 'nb' éléments de 'taille_element' octets à 'decalage' : après l'en-tête,
+    alignée et contenue dans le fichier. Comparaison par division : aucun débordement
+    quel que soit le contenu de l'en-tête. */
+static bool section_valide(uint64_t decalage, uint64_t nb, uint64_t taille_element, uint64_t taille) {
+    return decalage >= sizeof(EnTeteBinaire)
+        && decalage % ALIGNEMENT_SECTION == 0
+        && decalage <= taille
+        && nb <= (taille - decalage) / taille_element;
+}
+
+static const char* verifier_entete(const EnTeteBinaire* entete, uint64_t taille) {
+    if (entete->version != VERSION_BINAIRE) return "version non supportée";
+    if (entete->boutisme != BOUTISME_NATIF || entete->taille_ville != sizeof(Ville)) {
+        return "écrit sur une autre architecture";
+    }
+    if (entete->taille_fichier != taille) return "fichier tronqué";
+    int n = entete->dimension;
+    if (n <= 0 || entete->type_distance > DIST_EXPLICIT || entete->k_candidats < 0
+        || entete->k_candidats > n) {
+        return "en-tête invalide";
+    }
+    if (!section_valide(entete->decalage_villes, (uint64_t)n, sizeof(Ville), taille)) {
+        return "villes hors du fichier";
+    }
+    if (entete->decalage_matrice
+        && !section_valide(entete->decalage_matrice, (uint64_t)n * (uint64_t)(n - 1) / 2,
+                           sizeof(double), taille)) {
+        return "matrice hors du fichier";
+    }
+    if (entete->type_distance == DIST_EXPLICIT && !entete->decalage_matrice && n > 1) {
+        return "instance EXPLICIT sans matrice";
+    }
+    if (entete->k_candidats
+        && !section_valide(entete->decalage_candidats, (uint64_t)n * (uint64_t)entete->k_candidats,
+                           sizeof(int), taille)) {
+        return "candidats hors du fichier";
+    }
+    return NULL;
+}
+
+InstanceTSP* charger_instance_binaire(const char* nomFichier) {
+    int fd = open(nomFichier, O_RDONLY);
+    if (fd < 0) {
+        perror("Erreur ouverture du fichier");
+        return NULL;
+    }
+    struct stat etat;
+    if (fstat(fd, &etat) != 0 || (size_t)etat.st_size < sizeof(EnTeteBinaire)) {
+        fprintf(stderr, "Erreur: instance binaire '%s' : fichier invalide.\n", nomFichier);
+        close(fd);
+        return NULL;
+    }
+    size_t taille = (size_t)etat.st_size;
+    // Copie à l'écriture (MAP_PRIVATE) : le fichier n'est jamais modifié
+    char* base = (char*)mmap(NULL, taille, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        perror("Erreur projection de l'instance binaire");
+        return NULL;
+    }
+
+    const EnTeteBinaire* entete = (const EnTeteBinaire*)base;
+    const char* erreur = verifier_entete(entete, taille);
+    if (erreur) {
+        fprintf(stderr, "Erreur: instance binaire '%s' : %s.\n", nomFichier, erreur);
+        munmap(base, taille);
+        return NULL;
+    }
+
+    int n = entete->dimension;
+    const int* voisins = (const int*)(base + entete->decalage_candidats);
+    for (long long i = 0; i < (long long)n * entete->k_candidats; i++) {
+        if (voisins[i] < 0 || voisins[i] >= n) {
+            fprintf(stderr, "Erreur: instance binaire '%s' : candidats invalides.\n", nomFichier);
+            munmap(base, taille);
+            return NULL;
+        }
+    }
+
+    InstanceTSP* instance = (InstanceTSP*)calloc(1, sizeof(InstanceTSP));
+    double** lignes = entete->decalage_matrice ? (double**)malloc(n * sizeof(double*)) : NULL;
+    ListesCandidats* candidats = entete->k_candidats
+                               ? (ListesCandidats*)malloc(sizeof(ListesCandidats)) : NULL;
+    if (!instance || (entete->decalage_matrice && !lignes) || (entete->k_candidats && !candidats)) {
+        free(instance);
+        free(lignes);
+        free(candidats);
+        munmap(base, taille);
+        return NULL;
+    }
+
+    memcpy(instance->nom, entete->nom, NOM_MAX);
+    instance->nom[NOM_MAX - 1] = '\0';
+    memcpy(instance->commentaire, entete->commentaire, COMMENTAIRE_MAX);
+    instance->commentaire[COMMENTAIRE_MAX - 1] = '\0';
+    instance->dimension = n;
+    instance->type_distance = (TypeDistance)entete->type_distance;
+    instance->borne_inferieure = entete->borne_inferieure;
+    instance->villes = (Ville*)(base + entete->decalage_villes);
+    if (lignes) {
+        double* bloc = (double*)(base + entete->decalage_matrice);
+        lignes[0] = NULL;
+        for (int i = 1; i < n; i++) {
+            lignes[i] = bloc + (size_t)i * (i - 1) / 2;
+        }
+        instance->matrice_distances = lignes;
+        instance->matrice_existe = true;
+    }
+    if (candidats) {
+        candidats->n = n;
+        candidats->k = entete->k_candidats;
+        candidats->triee_par_distance = false;      // Candidats alpha-nearness (-a)
+        candidats->voisins = (int*)(base + entete->decalage_candidats);
+        instance->candidats = candidats;
+    }
+    instance->projection = base;
+    instance->taille_projection = taille;
+    return instance;
+}
@@ -0,0 +1,30 @@
+#ifndef INSTANCE_BINAIRE_H
+#define INSTANCE_BINAIRE_H
+
+#include <stdbool.h>
+#include "tsp.h"
+
+/**
+ * Instance binaire (--save-bin) : en-tête (signature, version, dimension, type
+ * de distance, nom, borne inférieure) puis, chacun au début d'une page, le
+ * tableau des villes, le bloc de la matrice triangulaire (si elle existe) et
+ * les listes de candidats (si -a les a calculées), en binaire natif.
+ *
+ * Au chargement, le fichier est projeté (mmap, copie à l'écriture) et l'instance
+ * pointe directement dans la projection : ni analyse du texte, ni calcul de la
+ * matrice, ni copie. Seul le tableau des débuts de lignes de la matrice est alloué.
+ */
+
+// Vrai si le fichier commence par la signature d'une instance binaire
+bool est_instance_binaire(const char* nomFichier);
+
+// NULL (message sur stderr) si le fichier est invalide ou d'une autre architecture
+InstanceTSP* charger_instance_binaire(const char* nomFichier);
+
+// Écrit "<fichier>.tmp" puis le renomme ; faux en cas d'erreur
+bool sauvegarder_instance_binaire(const InstanceTSP* instance, const char* nomFichier);
+
+// Vrai si 'adresse' est dans la projection de l'instance (à ne pas libérer avec free)
+bool instance_binaire_contient(const InstanceTSP* instance, const void* adresse);
+
+#endif
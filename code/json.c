@@ -0,0 +1,182 @@
+/**
+ * json.c
+ * Lecture et écriture JSON minimales (travaux du mode serveur, résultats des lots)
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "json.h"
+
+// Profondeur maximale des valeurs sautées (objets et tableaux imbriqués)
+#define JSON_PROFONDEUR_MAX 64
+
+const char* json_espaces(const char* p, const char* fin) {
+    while (p < fin && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) p++;
+    return p;
+}
+
+static int valeur_hexa(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Point de code \uXXXX encodé en UTF-8 (les paires de substitution sont refusées)
+static size_t encoder_utf8(unsigned code, char* sortie) {
+    if (code < 0x80) {
+        sortie[0] = (char)code;
+        return 1;
+    }
+    if (code < 0x800) {
+        sortie[0] = (char)(0xC0 | (code >> 6));
+        sortie[1] = (char)(0x80 | (code & 0x3F));
+        return 2;
+    }
+    sortie[0] = (char)(0xE0 | (code >> 12));
+    sortie[1] = (char)(0x80 | ((code >> 6) & 0x3F));
+    sortie[2] = (char)(0x80 | (code & 0x3F));
+    return 3;
+}
+
+const char* json_lire_chaine(const char* p, const char* fin, char* dest, size_t taille) {
+    if (p >= fin || *p != '"' || taille == 0) return NULL;
+    p++;
+    size_t n = 0;
+    while (p < fin && *p != '"') {
+        char morceau[4];
+        size_t longueur = 1;
+        if ((unsigned char)*p < 0x20) return NULL;
+        if (*p != '\\') {
+            morceau[0] = *p++;
+        } else {
+            if (++p >= fin) return NULL;
+            switch (*p) {
+            case '"': case '\\': case '/': morceau[0] = *p; break;
+            case 'b': morceau[0] = '\b'; break;
+            case 'f': morceau[0] = '\f'; break;
+            case 'n': morceau[0] = '\n'; break;
+            case 'r': morceau[0] = '\r'; break;
+            case 't': morceau[0] = '\t'; break;
+            case 'u': {
+                unsigned code = 0;
+                for (int i = 1; i <= 4; i++) {
+                    int chiffre = p + i < fin ? valeur_hexa(p[i]) : -1;
+                    if (chiffre < 0) return NULL;
+                    code = code * 16 + (unsigned)chiffre;
+                }
+                if (code >= 0xD800 && code <= 0xDFFF) return NULL;
+                longueur = encoder_utf8(code, morceau);
+                p += 4;
+                break;
+            }
+            default:
+                return NULL;
+            }
+            p++;
+        }
+        if (n + longueur >= taille) return NULL;
+        memcpy(dest + n, morceau, longueur);
+        n += longueur;
+    }
+    if (p >= fin) return NULL;
+    dest[n] = '\0';
+    return p + 1;
+}
+
+const char* json_lire_nombre(const char* p, const char* fin, double* valeur) {
+    // strtod accepte plus que JSON (hexadécimal, inf) : le nombre est d'abord délimité
+    const char* q = p;
+    if (q < fin && *q == '-') q++;
+    if (q >= fin || *q < '0' || *q > '9') return NULL;
+    while (q < fin && ((*q >= '0' && *q <= '9') || *q == '.' || *q == 'e' || *q == 'E'
+                       || *q == '+' || *q == '-')) {
+        q++;
+    }
+    char tampon[64];
+    size_t longueur = (size_t)(q - p);
+    if (longueur >= sizeof(tampon)) return NULL;
+    memcpy(tampon, p, longueur);
+    tampon[longueur] = '\0';
+    char* suite;
+    *valeur = strtod(tampon, &suite);
+    return suite == tampon + longueur ? q : NULL;
+}
+
+static const char* lire_mot(const char* p, const char* fin, const char* mot) {
+    size_t longueur = strlen(mot);
+    return (size_t)(fin - p) >= longueur && memcmp(p, mot, longueur) == 0 ? p + longueur : NULL;
+}
+
+const char* json_lire_booleen(const char* p, const char* fin, bool* valeur) {
+    const char* suite;
+    if ((suite = lire_mot(p, fin, "true"))) {
+        *valeur = true;
+        return suite;
+    }
+    if ((suite = lire_mot(p, fin, "false"))) {
+        *valeur = false;
+        return suite;
+    }
+    double nombre;
+    suite = json_lire_nombre(p, fin, &nombre);
+    if (suite) *valeur = nombre != 0.0;
+    return suite;
+}
+
+static const char* sauter(const char* p, const char* fin, int profondeur) {
+    if (p >= fin || profondeur > JSON_PROFONDEUR_MAX) return NULL;
+    if (*p == '"') {
+        // Même validation que json_lire_chaine, sans copie
+        for (p++; p < fin && *p != '"'; p++) {
+            if ((unsigned char)*p < 0x20) return NULL;
+            if (*p == '\\' && ++p >= fin) return NULL;
+        }
+        return p < fin ? p + 1 : NULL;
+    }
+    if (*p == '{' || *p == '[') {
+        char fermante = *p == '{' ? '}' : ']';
+        p = json_espaces(p + 1, fin);
+        if (p < fin && *p == fermante) return p + 1;
+        for (;;) {
+            if (fermante == '}') {
+                // Clé (chaîne) puis ':'
+                if (p >= fin || *p != '"') return NULL;
+                p = sauter(p, fin, profondeur + 1);
+                if (!p) return NULL;
+                p = json_espaces(p, fin);
+                if (p >= fin || *p != ':') return NULL;
+                p = json_espaces(p + 1, fin);
+            }
+            p = sauter(p, fin, profondeur + 1);
+            if (!p) return NULL;
+            p = json_espaces(p, fin);
+            if (p < fin && *p == ',') {
+                p = json_espaces(p + 1, fin);
+            } else if (p < fin && *p == fermante) {
+                return p + 1;
+            } else {
+                return NULL;
+            }
+        }
+    }
+    const char* suite;
+    if ((suite = lire_mot(p, fin, "null"))) return suite;
+    bool booleen;
+    return json_lire_booleen(p, fin, &booleen);
+}
+
+const char* json_sauter_valeur(const char* p, const char* fin) {
+    return sauter(p, fin, 0);
+}
+
+void json_ecrire_chaine(FILE* sortie, const char* texte) {
+    fputc('"', sortie);
+    for (const unsigned char* c = (const unsigned char*)texte; *c; c++) {
+        if (*c == '"' || *c == '\\') fprintf(sortie, "\\%c", *c);
+        else if (*c < 0x20) fprintf(sortie, "\\u%04x", *c);
+        else fputc(*c, sortie);
+    }
+    fputc('"', sortie);
+}
@@ -0,0 +1,28 @@
+#ifndef JSON_H
+#define JSON_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*  Lecture JSON minimale pour les objets plats du mode serveur : chaque fonction
+    lit une valeur à partir de 'p' (sans dépasser 'fin') et retourne la position
+    qui la suit, ou NULL si le texte n'est pas du JSON valide. */
+
+const char* json_espaces(const char* p, const char* fin);
+
+// Chaîne "..." copiée (échappements décodés) dans 'dest' ; NULL si elle ne tient pas
+const char* json_lire_chaine(const char* p, const char* fin, char* dest, size_t taille);
+
+const char* json_lire_nombre(const char* p, const char* fin, double* valeur);
+
+// true/false, ou nombre (vrai s'il est non nul)
+const char* json_lire_booleen(const char* p, const char* fin, bool* valeur);
+
+// Saute une valeur quelconque (objets et tableaux imbriqués compris)
+const char* json_sauter_valeur(const char* p, const char* fin);
+
+// Écrit 'texte' entre guillemets, échappé
+void json_ecrire_chaine(FILE* sortie, const char* texte);
+
+#endif
@@ -0,0 +1,340 @@
+/**
+ * lecteur.c
+ * Lecture de fichiers texte (projection en mémoire, gzip) et analyse des nombres
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <zlib.h>
+
+#include "lecteur.h"
+
+#define TAILLE_BLOC_LECTURE (1 << 20)
+
+// Tampon de décompression (agrandi si une ligne ne tient pas)
+#define TAILLE_TAMPON_GZIP (4 << 20)
+// Entrée fournie à inflate par morceaux (avail_in est un unsigned int)
+#define TAILLE_ENTREE_GZIP_MAX (1u << 30)
+
+// Au-delà, la mantisse ou la puissance de dix n'est plus exacte en double :
+// le résultat arrondi ne serait plus celui de strtod
+#define MANTISSE_EXACTE_MAX (1ULL << 53)
+#define EXPOSANT_EXACT_MAX 22
+#define CHIFFRES_MANTISSE_MAX 19
+
+static const double PUISSANCES_DIX[EXPOSANT_EXACT_MAX + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Fichiers non projetables (tubes, /dev/stdin) : lecture complète en mémoire
+static bool lire_entierement(Lecteur* lecteur, int fd) {
+    size_t capacite = TAILLE_BLOC_LECTURE;
+    char* tampon = (char*)malloc(capacite);
+    size_t taille = 0;
+    while (tampon) {
+        if (taille == capacite) {
+            capacite *= 2;
+            char* agrandi = (char*)realloc(tampon, capacite);
+            if (!agrandi) break;
+            tampon = agrandi;
+        }
+        ssize_t lus = read(fd, tampon + taille, capacite - taille);
+        if (lus < 0) break;
+        if (lus == 0) {
+            lecteur->donnees = tampon;
+            lecteur->taille = taille;
+            lecteur->projete = false;
+            return true;
+        }
+        taille += (size_t)lus;
+    }
+    free(tampon);
+    return false;
+}
+
+// Décompression gzip : le fichier compressé reste projeté, les caractères
+// décompressés passent par 'tampon' ; [lecteur->fin, tampon + decompresses)
+// est la ligne incomplète gardée pour le remplissage suivant
+typedef struct {
+    z_stream z;
+    char* tampon;
+    size_t capacite;
+    size_t decompresses;
+    size_t entree_restante;     // Octets compressés pas encore fournis à inflate
+    bool termine;
+} FluxGzip;
+
+static bool est_gzip(const Lecteur* lecteur) {
+    const unsigned char* octets = (const unsigned char*)lecteur->donnees;
+    return lecteur->taille >= 2 && octets[0] == 0x1f && octets[1] == 0x8b;
+}
+
+// Décompresse jusqu'à remplir le tampon ; faux en cas d'erreur
+static bool decompresser(FluxGzip* flux) {
+    while (!flux->termine && flux->decompresses < flux->capacite) {
+        if (flux->z.avail_in == 0 && flux->entree_restante > 0) {
+            uInt morceau = flux->entree_restante > TAILLE_ENTREE_GZIP_MAX
+                         ? TAILLE_ENTREE_GZIP_MAX : (uInt)flux->entree_restante;
+            flux->z.avail_in = morceau;
+            flux->entree_restante -= morceau;
+        }
+        flux->z.next_out = (Bytef*)flux->tampon + flux->decompresses;
+        flux->z.avail_out = (uInt)(flux->capacite - flux->decompresses);
+        int retour = inflate(&flux->z, Z_NO_FLUSH);
+        flux->decompresses = flux->capacite - flux->z.avail_out;
+
+        if (retour == Z_STREAM_END) {
+            // Plusieurs membres gzip concaténés (gzip a.tsp >> b.gz)
+            if (flux->z.avail_in == 0 && flux->entree_restante == 0) flux->termine = true;
+            else if (inflateReset(&flux->z) != Z_OK) return false;
+        } else if (retour == Z_BUF_ERROR && flux->z.avail_in == 0 && flux->entree_restante == 0) {
+            fprintf(stderr, "Erreur: fichier gzip tronqué.\n");
+            return false;
+        } else if (retour != Z_OK && retour != Z_BUF_ERROR) {
+            fprintf(stderr, "Erreur: fichier gzip corrompu (%s).\n",
+                    flux->z.msg ? flux->z.msg : "inflate");
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool remplir_gzip(Lecteur* lecteur) {
+    FluxGzip* flux = (FluxGzip*)lecteur->flux;
+    if (lecteur->erreur) return false;
+
+    size_t reste = (size_t)(flux->tampon + flux->decompresses - lecteur->fin);
+    memmove(flux->tampon, lecteur->fin, reste);
+    flux->decompresses = reste;
+
+    while (1) {
+        if (!decompresser(flux)) {
+            lecteur->erreur = true;
+            return false;
+        }
+        // Dernière fin de ligne du tampon
+        size_t fin = flux->decompresses;
+        while (fin > 0 && flux->tampon[fin - 1] != '\n') fin--;
+        if (flux->termine) fin = flux->decompresses;
+        if (fin > 0 || flux->termine) {
+            lecteur->pos = flux->tampon;
+            lecteur->fin = flux->tampon + fin;
+            return fin > 0;
+        }
+        // Ligne plus longue que le tampon
+        char* agrandi = (char*)realloc(flux->tampon, flux->capacite * 2);
+        if (!agrandi) {
+            lecteur->erreur = true;
+            return false;
+        }
+        flux->tampon = agrandi;
+        flux->capacite *= 2;
+    }
+}
+
+static bool ouvrir_gzip(Lecteur* lecteur) {
+    FluxGzip* flux = (FluxGzip*)calloc(1, sizeof(FluxGzip));
+    if (!flux) return false;
+    flux->capacite = TAILLE_TAMPON_GZIP;
+    flux->tampon = (char*)malloc(flux->capacite);
+    // 15 + 16 : fenêtre maximale, en-tête gzip attendu
+    if (!flux->tampon || inflateInit2(&flux->z, 15 + 16) != Z_OK) {
+        free(flux->tampon);
+        free(flux);
+        return false;
+    }
+    flux->z.next_in = (Bytef*)lecteur->donnees;
+    flux->z.avail_in = 0;
+    flux->entree_restante = lecteur->taille;
+
+    lecteur->flux = flux;
+    lecteur->remplir = remplir_gzip;
+    lecteur->pos = flux->tampon;
+    lecteur->fin = flux->tampon;
+    return true;
+}
+
+Lecteur* ouvrir_lecteur(const char* nomFichier) {
+    int fd = open(nomFichier, O_RDONLY);
+    if (fd < 0) {
+        perror("Erreur ouverture du fichier");
+        return NULL;
+    }
+    Lecteur* lecteur = (Lecteur*)calloc(1, sizeof(Lecteur));
+    if (!lecteur) {
+        close(fd);
+        return NULL;
+    }
+
+    struct stat etat;
+    if (fstat(fd, &etat) == 0 && S_ISREG(etat.st_mode) && etat.st_size > 0) {
+        void* projection = mmap(NULL, (size_t)etat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (projection != MAP_FAILED) {
+            madvise(projection, (size_t)etat.st_size, MADV_SEQUENTIAL);
+            lecteur->donnees = projection;
+            lecteur->taille = (size_t)etat.st_size;
+            lecteur->projete = true;
+        }
+    }
+    if (!lecteur->donnees && !lire_entierement(lecteur, fd)) {
+        perror("Erreur lecture du fichier");
+        close(fd);
+        free(lecteur);
+        return NULL;
+    }
+    close(fd);
+
+    if (est_gzip(lecteur)) {
+        if (!ouvrir_gzip(lecteur)) {
+            fprintf(stderr, "Erreur: initialisation de la décompression gzip.\n");
+            fermer_lecteur(lecteur);
+            return NULL;
+        }
+    } else {
+        lecteur->pos = (const char*)lecteur->donnees;
+        lecteur->fin = lecteur->pos + lecteur->taille;
+    }
+    return lecteur;
+}
+
+void fermer_lecteur(Lecteur* lecteur) {
+    if (!lecteur) return;
+    FluxGzip* flux = (FluxGzip*)lecteur->flux;
+    if (flux) {
+        inflateEnd(&flux->z);
+        free(flux->tampon);
+        free(flux);
+    }
+    if (lecteur->projete) {
+        munmap(lecteur->donnees, lecteur->taille);
+    } else {
+        free(lecteur->donnees);
+    }
+    free(lecteur);
+}
+
+bool lecteur_ligne(Lecteur* lecteur, const char** debut, const char** fin) {
+    if (lecteur->pos >= lecteur->fin && !(lecteur->remplir && lecteur->remplir(lecteur))) {
+        return false;
+    }
+    const char* p = lecteur->pos;
+    const char* fin_ligne = (const char*)memchr(p, '\n', (size_t)(lecteur->fin - p));
+    if (fin_ligne) {
+        lecteur->pos = fin_ligne + 1;
+    } else {
+        fin_ligne = lecteur->fin;
+        lecteur->pos = lecteur->fin;
+    }
+    if (fin_ligne > p && fin_ligne[-1] == '\r') fin_ligne--;
+    lecteur->ligne++;
+    *debut = p;
+    *fin = fin_ligne;
+    return true;
+}
+
+const char* sauter_espaces(const char* p, const char* fin) {
+    while (p < fin && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) p++;
+    return p;
+}
+
+static bool est_chiffre(char c) {
+    return c >= '0' && c <= '9';
+}
+
+const char* analyser_entier(const char* p, const char* fin, long long* valeur) {
+    bool negatif = false;
+    if (p < fin && (*p == '-' || *p == '+')) negatif = (*p++ == '-');
+    const char* debut = p;
+    long long v = 0;
+    while (p < fin && est_chiffre(*p)) {
+        if (p - debut >= CHIFFRES_MANTISSE_MAX - 1) return NULL;     // Dépassement
+        v = v * 10 + (*p++ - '0');
+    }
+    if (p == debut) return NULL;
+    *valeur = negatif ? -v : v;
+    return p;
+}
+
+// Cas général (mantisse longue, grand exposant) : strtod sur une copie terminée par '\0'
+static const char* analyser_reel_strtod(const char* debut, const char* p, double* valeur) {
+    char tampon[128];
+    size_t longueur = (size_t)(p - debut);
+    if (longueur >= sizeof(tampon)) return NULL;
+    memcpy(tampon, debut, longueur);
+    tampon[longueur] = '\0';
+    *valeur = strtod(tampon, NULL);
+    return p;
+}
+
+/**
+ * La mantisse décimale est accumulée dans un entier ; tant qu'elle est exacte
+ * en double (< 2^53) et que la puissance de dix l'est aussi (|e| <= 22), une
+ * seule multiplication ou division donne le double correctement arrondi, donc
+ * le même que strtod. Les autres cas, rares dans TSPLIB, passent par strtod.
+ */
+const char* analyser_reel(const char* p, const char* fin, double* valeur) {
+    const char* debut = p;
+    bool negatif = false;
+    if (p < fin && (*p == '-' || *p == '+')) negatif = (*p++ == '-');
+
+    uint64_t mantisse = 0;
+    int chiffres = 0;           // Chiffres significatifs accumulés
+    int exposant = 0;
+    bool tronque = false;
+    bool chiffre_lu = false;
+
+    for (; p < fin && est_chiffre(*p); p++) {
+        chiffre_lu = true;
+        if (chiffres < CHIFFRES_MANTISSE_MAX) {
+            mantisse = mantisse * 10 + (uint64_t)(*p - '0');
+            if (mantisse) chiffres++;
+        } else {
+            exposant++;
+            tronque = true;
+        }
+    }
+    if (p < fin && *p == '.') {
+        for (p++; p < fin && est_chiffre(*p); p++) {
+            chiffre_lu = true;
+            if (chiffres < CHIFFRES_MANTISSE_MAX) {
+                mantisse = mantisse * 10 + (uint64_t)(*p - '0');
+                if (mantisse) chiffres++;
+                exposant--;
+            } else {
+                tronque = true;
+            }
+        }
+    }
+    if (!chiffre_lu) return NULL;
+
+    // Exposant, seulement s'il est suivi d'au moins un chiffre (comme strtod)
+    if (p < fin && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        bool exposant_negatif = false;
+        if (q < fin && (*q == '-' || *q == '+')) exposant_negatif = (*q++ == '-');
+        if (q < fin && est_chiffre(*q)) {
+            int e = 0;
+            for (; q < fin && est_chiffre(*q); q++) {
+                if (e < 100000) e = e * 10 + (*q - '0');
+            }
+            exposant += exposant_negatif ? -e : e;
+            p = q;
+        }
+    }
+
+    if (tronque || mantisse > MANTISSE_EXACTE_MAX
+        || exposant > EXPOSANT_EXACT_MAX || exposant < -EXPOSANT_EXACT_MAX) {
+        return analyser_reel_strtod(debut, p, valeur);
+    }
+    double v = (double)mantisse;
+    v = exposant >= 0 ? v * PUISSANCES_DIX[exposant] : v / PUISSANCES_DIX[-exposant];
+    *valeur = negatif ? -v : v;
+    return p;
+}
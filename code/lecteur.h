@@ -0,0 +1,41 @@
+#ifndef LECTEUR_H
+#define LECTEUR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * Lecture rapide d'un fichier texte : le fichier est projeté en mémoire (mmap)
+ * et parcouru ligne par ligne sans copie. Un fichier compressé par gzip est
+ * détecté à sa signature et décompressé au fil de la lecture dans un tampon
+ * (zlib), sans fichier temporaire. Les caractères disponibles sont [pos, fin) ;
+ * 'fin' tombe toujours en fin de ligne (sauf en fin de fichier), si bien qu'un
+ * nombre n'est jamais coupé entre deux remplissages.
+ */
+typedef struct Lecteur {
+    const char* pos;                        // Prochain caractère
+    const char* fin;                        // Fin des caractères disponibles
+    bool (*remplir)(struct Lecteur*);       // Caractères suivants ; NULL : tout est disponible
+    void* donnees;                          // Fichier projeté ou copié en mémoire
+    size_t taille;
+    bool projete;                           // Vrai si 'donnees' vient de mmap
+    void* flux;                             // Décompression gzip en cours (NULL : texte brut)
+    bool erreur;                            // Fichier compressé corrompu ou tronqué
+    long ligne;                             // Numéro de la dernière ligne lue (messages d'erreur)
+} Lecteur;
+
+// Ouvre un fichier ; NULL (message sur stderr) en cas d'erreur
+Lecteur* ouvrir_lecteur(const char* nomFichier);
+void fermer_lecteur(Lecteur* lecteur);
+
+// Ligne suivante dans [*debut, *fin), sans le '\n' ni le '\r' ; faux en fin de fichier
+// (ou en cas d'erreur de décompression : 'erreur' est alors vrai)
+bool lecteur_ligne(Lecteur* lecteur, const char** debut, const char** fin);
+
+// Analyse des nombres dans [p, fin) : retournent la position qui suit le nombre,
+// NULL s'il n'y en a pas. analyser_reel donne le même double que strtod.
+const char* sauter_espaces(const char* p, const char* fin);
+const char* analyser_entier(const char* p, const char* fin, long long* valeur);
+const char* analyser_reel(const char* p, const char* fin, double* valeur);
+
+#endif
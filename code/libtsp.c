@@ -0,0 +1,243 @@
+/**
+ * libtsp.c
+ * Bibliothèque partagée : chargement, matrice, résolution et tournées
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "libtsp.h"
+#include "tsp.h"
+#include "parser.h"
+#include "distance.h"
+#include "matrice.h"
+#include "candidats.h"
+#include "alpha.h"
+#include "tsp_utils.h"
+#include "methodes.h"
+#include "dynamique.h"
+#include "chrono.h"
+
+struct TspInstance {
+    InstanceTSP* instance;
+    FonctionDistance dist_func;
+};
+
+struct TspOptions {
+    ParamsMethode params;
+};
+
+struct TspResultat {
+    int* villes;            // Numéros TSPLIB
+    int taille;
+    double longueur;
+    double temps;
+};
+
+int tsp_version(void) {
+    return LIBTSP_VERSION;
+}
+
+TspInstance* tsp_charger(const char* fichier) {
+    if (!fichier) return NULL;
+    InstanceTSP* instance = lire_fichier_tsplib(fichier);
+    if (!instance) return NULL;
+    FonctionDistance dist_func = obtenir_fonction_distance(instance->type_distance);
+    TspInstance* resultat = dist_func ? (TspInstance*)malloc(sizeof(TspInstance)) : NULL;
+    if (!resultat) {
+        liberer_instance(instance);
+        return NULL;
+    }
+    // Les candidats d'une instance binaire ne servent qu'après tsp_calculer_candidats_alpha
+    if (instance->candidats) {
+        retirer_candidats_instance(instance);
+        instance->borne_inferieure = 0.0;
+    }
+    resultat->instance = instance;
+    resultat->dist_func = dist_func;
+    return resultat;
+}
+
+void tsp_liberer(TspInstance* instance) {
+    if (instance) {
+        liberer_instance(instance->instance);
+        free(instance);
+    }
+}
+
+int tsp_dimension(const TspInstance* instance) {
+    return instance ? instance->instance->dimension : -1;
+}
+
+const char* tsp_nom(const TspInstance* instance) {
+    return instance ? instance->instance->nom : NULL;
+}
+
+int tsp_calculer_matrice(TspInstance* instance) {
+    if (!instance) return -1;
+    if (!instance->instance->matrice_existe) {
+        calculer_matrice_distances(instance->instance, instance->dist_func);
+    }
+    return instance->instance->matrice_existe ? 0 : -1;
+}
+
+int tsp_calculer_candidats_alpha(TspInstance* instance, double* borne) {
+    if (!instance) return -1;
+    InstanceTSP* donnees = instance->instance;
+    if (!donnees->candidats) {
+        bool borne_exacte;
+        donnees->candidats = calculer_candidats_alpha(donnees, instance->dist_func, NB_CANDIDATS_DEFAUT,
+                                                      &donnees->borne_inferieure, &borne_exacte);
+    }
+    if (!donnees->candidats) return -1;
+    if (borne) *borne = donnees->borne_inferieure;
+    return 0;
+}
+
+// Tournée (indices 1-based) des numéros TSPLIB 'villes' ; NULL si ce n'est pas une permutation
+static Tournee* tournee_depuis_numeros(const InstanceTSP* donnees, const int* villes, int taille) {
+    int n = donnees->dimension;
+    if (taille != n) return NULL;
+
+    // Numéro TSPLIB -> indice (1-based) dans l'instance
+    int* indice_de_numero = (int*)calloc(n + 1, sizeof(int));
+    Tournee* tournee = creer_tournee(n);
+    bool ok = indice_de_numero && tournee;
+    for (int i = 0; ok && i < n; i++) {
+        int numero = donnees->villes[i].numero;
+        ok = numero >= 1 && numero <= n;
+        if (ok) indice_de_numero[numero] = i + 1;
+    }
+    for (int i = 0; ok && i < n; i++) {
+        int numero = villes[i];
+        ok = numero >= 1 && numero <= n && indice_de_numero[numero] > 0;
+        if (ok) {
+            tournee->chemin[i] = indice_de_numero[numero];
+            indice_de_numero[numero] = 0;       // Déjà visitée
+        }
+    }
+    free(indice_de_numero);
+    if (!ok) {
+        liberer_tournee(tournee);
+        return NULL;
+    }
+    return tournee;
+}
+
+// Résultat (numéros TSPLIB) de la tournée, libérée ; NULL si tournee est NULL
+static TspResultat* creer_resultat(const InstanceTSP* donnees, Tournee* tournee, double temps) {
+    TspResultat* resultat = tournee ? (TspResultat*)malloc(sizeof(TspResultat)) : NULL;
+    int* numeros = resultat ? (int*)malloc(tournee->taille * sizeof(int)) : NULL;
+    if (!numeros) {
+        free(resultat);
+        liberer_tournee(tournee);
+        return NULL;
+    }
+    for (int i = 0; i < tournee->taille; i++) {
+        numeros[i] = donnees->villes[tournee->chemin[i] - 1].numero;
+    }
+    resultat->villes = numeros;
+    resultat->taille = tournee->taille;
+    resultat->longueur = tournee->distanceTotale;
+    resultat->temps = temps;
+    liberer_tournee(tournee);
+    return resultat;
+}
+
+double tsp_longueur_tournee(const TspInstance* instance, const int* villes, int taille) {
+    if (!instance || !villes) return -1.0;
+    Tournee* tournee = tournee_depuis_numeros(instance->instance, villes, taille);
+    double longueur = tournee ? calculer_longueur_tournee(tournee, instance->instance, instance->dist_func)
+                              : -1.0;
+    liberer_tournee(tournee);
+    return longueur;
+}
+
+TspResultat* tsp_appliquer_delta(TspInstance* instance, const char* fichier_delta,
+                                 const int* villes, int taille) {
+    if (!instance || !fichier_delta || !villes) return NULL;
+    Tournee* tournee = tournee_depuis_numeros(instance->instance, villes, taille);
+    Delta* delta = tournee ? lire_fichier_delta(fichier_delta) : NULL;
+    Tournee* reparee = NULL;
+    ResumeDelta resume;
+    double debut = temps_mur();
+    InstanceTSP* modifiee = delta ? appliquer_delta(instance->instance, instance->dist_func, tournee, delta,
+                                                    &reparee, &resume) : NULL;
+    double temps = temps_mur() - debut;
+    liberer_delta(delta);
+    liberer_tournee(tournee);
+    if (!modifiee) return NULL;
+    // Résultat construit avant le remplacement : en cas d'échec, l'instance reste inchangée
+    TspResultat* resultat = creer_resultat(modifiee, reparee, temps);
+    if (!resultat) {
+        liberer_instance(modifiee);
+        return NULL;
+    }
+    liberer_instance(instance->instance);
+    instance->instance = modifiee;
+    return resultat;
+}
+
+TspOptions* tsp_options_creer(void) {
+    TspOptions* options = (TspOptions*)malloc(sizeof(TspOptions));
+    if (options) params_methode_defaut(&options->params);
+    return options;
+}
+
+void tsp_options_liberer(TspOptions* options) {
+    free(options);
+}
+
+int tsp_options_definir(TspOptions* options, const char* nom, double valeur) {
+    if (!options || !nom) return -1;
+    ParamsMethode* params = &options->params;
+    if (strcmp(nom, "grille") == 0) params->avec_grille = valeur != 0.0;
+    else if (strcmp(nom, "runs") == 0) params->nb_runs = (int)valeur;
+    else if (strcmp(nom, "threads") == 0) params->nb_threads = (int)valeur;
+    else if (strcmp(nom, "perturbations") == 0) params->nb_perturbations = (long long)valeur;
+    else if (strcmp(nom, "duree") == 0) params->duree = valeur;
+    else if (strcmp(nom, "individus") == 0) params->nb_individus = (int)valeur;
+    else if (strcmp(nom, "generations") == 0) params->nb_generations = (int)valeur;
+    else if (strcmp(nom, "mutation") == 0) params->taux_mutation = valeur;
+    else if (strcmp(nom, "graine") == 0) params->graine = (uint64_t)valeur;
+    else return -1;
+    return 0;
+}
+
+TspResultat* tsp_resoudre(const TspInstance* instance, const char* methode, const TspOptions* options) {
+    if (!instance || !methode) return NULL;
+    ParamsMethode defaut;
+    params_methode_defaut(&defaut);
+    const ParamsMethode* params = options ? &options->params : &defaut;
+
+    double temps;
+    Tournee* tournee = resoudre_methode(instance->instance, instance->dist_func, methode, params, &temps);
+    return creer_resultat(instance->instance, tournee, temps);
+}
+
+void tsp_resultat_liberer(TspResultat* resultat) {
+    if (resultat) {
+        free(resultat->villes);
+        free(resultat);
+    }
+}
+
+double tsp_resultat_longueur(const TspResultat* resultat) {
+    return resultat ? resultat->longueur : -1.0;
+}
+
+double tsp_resultat_temps(const TspResultat* resultat) {
+    return resultat ? resultat->temps : -1.0;
+}
+
+int tsp_resultat_taille(const TspResultat* resultat) {
+    return resultat ? resultat->taille : 0;
+}
+
+int tsp_resultat_tournee(const TspResultat* resultat, int* villes, int taille) {
+    if (!resultat || !villes) return 0;
+    int copie = taille < resultat->taille ? taille : resultat->taille;
+    memcpy(villes, resultat->villes, copie * sizeof(int));
+    return copie;
+}
@@ -0,0 +1,103 @@
+/**
+ * libtsp.h
+ * Interface C de la bibliothèque partagée libtsp.so
+ *
+ * Seules les fonctions de ce fichier sont exportées. Les types sont opaques :
+ * leur contenu peut changer sans casser les programmes liés à la bibliothèque.
+ * Les erreurs sont signalées par une valeur de retour (NULL ou négative) et un
+ * message sur la sortie d'erreur.
+ *
+ * Utilisation :
+ *     TspInstance* instance = tsp_charger("a280.tsp");
+ *     tsp_calculer_matrice(instance);
+ *     TspResultat* resultat = tsp_resoudre(instance, "2optnn", NULL);
+ *     double longueur = tsp_resultat_longueur(resultat);
+ *     tsp_resultat_liberer(resultat);
+ *     tsp_liberer(instance);
+ *
+ * Une instance peut servir à plusieurs résolutions, y compris en même temps
+ * depuis plusieurs threads, tant qu'elle n'est ni modifiée (tsp_calculer_*,
+ * tsp_appliquer_delta) ni libérée pendant ce temps.
+ */
+
+#ifndef LIBTSP_H
+#define LIBTSP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Version de l'interface, incrémentée à chaque changement incompatible
+#define LIBTSP_VERSION 1
+
+#define LIBTSP_API __attribute__((visibility("default")))
+
+typedef struct TspInstance TspInstance;
+typedef struct TspOptions TspOptions;
+typedef struct TspResultat TspResultat;
+
+LIBTSP_API int tsp_version(void);
+
+/* ---- Instances ---- */
+
+// Fichier TSPLIB (texte, .gz) ou instance binaire (--save-bin) ; NULL en cas d'erreur
+LIBTSP_API TspInstance* tsp_charger(const char* fichier);
+LIBTSP_API void tsp_liberer(TspInstance* instance);
+
+LIBTSP_API int tsp_dimension(const TspInstance* instance);
+LIBTSP_API const char* tsp_nom(const TspInstance* instance);
+
+// Matrice des distances (sans effet si elle existe déjà) ; 0 si elle existe, -1 sinon
+// (échec d'allocation). Sans matrice, les distances sont calculées à la volée.
+LIBTSP_API int tsp_calculer_matrice(TspInstance* instance);
+
+// Borne de Held-Karp et candidats alpha-nearness (option -a), utilisés ensuite par
+// sa, ils et aco ; 0 si OK (borne dans *borne si non NULL), -1 sinon
+LIBTSP_API int tsp_calculer_candidats_alpha(TspInstance* instance, double* borne);
+
+// Longueur de la tournée 'villes' (numéros TSPLIB), -1 si ce n'est pas une
+// permutation des villes de l'instance
+LIBTSP_API double tsp_longueur_tournee(const TspInstance* instance, const int* villes, int taille);
+
+/* ---- Modifications de l'instance ---- */
+
+// Applique un fichier de modifications ("+ x y", "- numero", "~ numero x y", voir
+// dynamique.h) : l'instance est remplacée par l'instance modifiée (villes gardées
+// renumérotées de 1 à m, villes ajoutées à la suite, matrice mise à jour si elle
+// existait) et la tournée 'villes' (numéros TSPLIB de l'instance d'avant) est
+// réparée localement. NULL en cas d'erreur, l'instance restant inchangée.
+LIBTSP_API TspResultat* tsp_appliquer_delta(TspInstance* instance, const char* fichier_delta,
+                                            const int* villes, int taille);
+
+/* ---- Options de résolution ---- */
+
+// Options par défaut de la ligne de commande
+LIBTSP_API TspOptions* tsp_options_creer(void);
+LIBTSP_API void tsp_options_liberer(TspOptions* options);
+
+// Noms : "grille" (-g, 0/1), "runs" (-r), "threads" (-j), "perturbations" (-k),
+// "duree" (-t, secondes), "individus", "generations", "mutation",
+// "graine" (rw, 2optrw, sa, ils, aco, ga, gadpx, portfolio ; 0 = graine par défaut).
+// 0 si OK, -1 si le nom est inconnu.
+LIBTSP_API int tsp_options_definir(TspOptions* options, const char* nom, double valeur);
+
+/* ---- Résolution ---- */
+
+// Méthodes de la ligne de commande (nn, 2optnn, ..., ils, portfolio, ga, gadpx) ;
+// options NULL : valeurs par défaut. NULL si la méthode est inconnue ou a échoué.
+LIBTSP_API TspResultat* tsp_resoudre(const TspInstance* instance, const char* methode,
+                                     const TspOptions* options);
+LIBTSP_API void tsp_resultat_liberer(TspResultat* resultat);
+
+LIBTSP_API double tsp_resultat_longueur(const TspResultat* resultat);
+// Temps écoulé de la résolution, en secondes
+LIBTSP_API double tsp_resultat_temps(const TspResultat* resultat);
+LIBTSP_API int tsp_resultat_taille(const TspResultat* resultat);
+// Copie au plus 'taille' villes de la tournée (numéros TSPLIB) ; retourne le nombre copié
+LIBTSP_API int tsp_resultat_tournee(const TspResultat* resultat, int* villes, int taille);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
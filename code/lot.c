@@ -0,0 +1,328 @@
+/**
+ * lot.c
+ * Mode lot : plusieurs instances × méthodes dans un seul processus, sortie CSV/JSON
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "lot.h"
+#include "parser.h"
+#include "tsp_utils.h"
+#include "parallele.h"
+#include "chrono.h"
+#include "json.h"
+
+#define LIGNE_MANIFESTE_MAX 4096
+#define SEPARATEURS_MANIFESTE " \t\r\n,"
+
+// Une ligne du manifeste
+typedef struct {
+    char* fichier;
+    char** methodes;
+    int nb_methodes;
+} EntreeLot;
+
+// Lignes de résultats d'une instance, écrites dans l'ordre du manifeste
+typedef struct {
+    char* texte;
+    size_t taille;
+    bool termine;
+    bool echec;
+} ResultatLot;
+
+// Données partagées par les threads
+typedef struct {
+    const EntreeLot* entrees;
+    int nb_entrees;
+    const ParamsLot* params;
+    ResultatLot* resultats;
+    int prochaine;              // Prochaine instance à distribuer (protégé par 'verrou')
+    pthread_mutex_t verrou;
+    pthread_cond_t termine;     // Signalé à chaque instance terminée
+} TravailLot;
+
+static void liberer_entrees(EntreeLot* entrees, int nb_entrees) {
+    for (int i = 0; i < nb_entrees; i++) {
+        free(entrees[i].fichier);
+        for (int m = 0; m < entrees[i].nb_methodes; m++) {
+            free(entrees[i].methodes[m]);
+        }
+        free(entrees[i].methodes);
+    }
+    free(entrees);
+}
+
+// Ajoute les méthodes de 'liste' (modifiée par strtok_r) à l'entrée ; false si l'une est inconnue
+static bool ajouter_methodes(EntreeLot* entree, char* liste, const char* manifeste, int numero_ligne) {
+    char* reste = NULL;
+    for (char* mot = strtok_r(liste, SEPARATEURS_MANIFESTE, &reste); mot;
+         mot = strtok_r(NULL, SEPARATEURS_MANIFESTE, &reste)) {
+        if (!methode_existe(mot)) {
+            fprintf(stderr, "Erreur: %s, ligne %d : méthode '%s' non reconnue.\n",
+                    manifeste, numero_ligne, mot);
+            return false;
+        }
+        char** methodes = (char**)realloc(entree->methodes, (entree->nb_methodes + 1) * sizeof(char*));
+        if (!methodes) return false;
+        entree->methodes = methodes;
+        entree->methodes[entree->nb_methodes] = strdup(mot);
+        if (!entree->methodes[entree->nb_methodes]) return false;
+        entree->nb_methodes++;
+    }
+    return true;
+}
+
+static EntreeLot* lire_manifeste(const char* manifeste, const char* methodes_defaut, int* nb_entrees) {
+    FILE* f = fopen(manifeste, "r");
+    if (!f) {
+        perror("Erreur ouverture du manifeste");
+        return NULL;
+    }
+    EntreeLot* entrees = NULL;
+    int nb = 0;
+    bool ok = true;
+    char ligne[LIGNE_MANIFESTE_MAX];
+    for (int numero_ligne = 1; ok && fgets(ligne, sizeof(ligne), f); numero_ligne++) {
+        char* commentaire = strchr(ligne, '#');
+        if (commentaire) *commentaire = '\0';
+        char* reste = NULL;
+        char* fichier = strtok_r(ligne, " \t\r\n", &reste);
+        if (!fichier) continue;
+
+        EntreeLot* agrandi = (EntreeLot*)realloc(entrees, (nb + 1) * sizeof(EntreeLot));
+        if (!agrandi) {
+            ok = false;
+            break;
+        }
+        entrees = agrandi;
+        EntreeLot* entree = &entrees[nb++];
+        entree->fichier = strdup(fichier);
+        entree->methodes = NULL;
+        entree->nb_methodes = 0;
+        ok = entree->fichier && ajouter_methodes(entree, reste, manifeste, numero_ligne);
+        if (ok && entree->nb_methodes == 0) {
+            char defaut[LIGNE_MANIFESTE_MAX];
+            snprintf(defaut, sizeof(defaut), "%s", methodes_defaut ? methodes_defaut : "");
+            ok = ajouter_methodes(entree, defaut, manifeste, numero_ligne);
+            if (ok && entree->nb_methodes == 0) {
+                fprintf(stderr, "Erreur: %s, ligne %d : aucune méthode (ni sur la ligne, ni par -m).\n",
+                        manifeste, numero_ligne);
+                ok = false;
+            }
+        }
+    }
+    fclose(f);
+    if (ok && nb == 0) {
+        fprintf(stderr, "Erreur: manifeste '%s' vide.\n", manifeste);
+        ok = false;
+    }
+    if (!ok) {
+        liberer_entrees(entrees, nb);
+        return NULL;
+    }
+    *nb_entrees = nb;
+    return entrees;
+}
+
+static void ecrire_chaine_csv(FILE* sortie, const char* texte) {
+    if (!strpbrk(texte, ",\"\n")) {
+        fputs(texte, sortie);
+        return;
+    }
+    fputc('"', sortie);
+    for (const char* c = texte; *c; c++) {
+        if (*c == '"') fputc('"', sortie);
+        fputc(*c, sortie);
+    }
+    fputc('"', sortie);
+}
+
+static void ecrire_entete(FILE* sortie, FormatLot format) {
+    if (format == FORMAT_LOT_CSV) {
+        fprintf(sortie, "fichier,instance,dimension,methode,longueur,temps,preparation,borne,statut\n");
+    }
+}
+
+// Nombre ou champ vide (CSV) / null (JSON) si 'present' est faux
+static void ecrire_nombre(FILE* sortie, FormatLot format, bool present, double valeur) {
+    if (present) fprintf(sortie, "%.6f", valeur);
+    else if (format == FORMAT_LOT_JSON) fputs("null", sortie);
+}
+
+typedef struct {
+    const char* fichier;
+    const InstanceTSP* instance;    // NULL si le chargement a échoué
+    double preparation;             // Lecture, matrice et candidats (secondes)
+    bool avec_borne;
+} ContexteLot;
+
+static void ecrire_resultat(FILE* sortie, FormatLot format, const ContexteLot* contexte,
+                            const char* methode, const Tournee* tournee, double temps) {
+    const InstanceTSP* instance = contexte->instance;
+    const char* nom = instance ? instance->nom : "";
+    const char* statut = tournee ? "ok" : "erreur";
+    bool avec_borne = instance && contexte->avec_borne;
+
+    if (format == FORMAT_LOT_CSV) {
+        ecrire_chaine_csv(sortie, contexte->fichier);
+        fputc(',', sortie);
+        ecrire_chaine_csv(sortie, nom);
+        fputc(',', sortie);
+        if (instance) fprintf(sortie, "%d", instance->dimension);
+        fprintf(sortie, ",%s,", methode);
+        ecrire_nombre(sortie, format, tournee, tournee ? tournee->distanceTotale : 0.0);
+        fputc(',', sortie);
+        ecrire_nombre(sortie, format, tournee, temps);
+        fputc(',', sortie);
+        ecrire_nombre(sortie, format, instance, contexte->preparation);
+        fputc(',', sortie);
+        ecrire_nombre(sortie, format, avec_borne, avec_borne ? instance->borne_inferieure : 0.0);
+        fprintf(sortie, ",%s\n", statut);
+    } else {
+        fputs("{\"fichier\":", sortie);
+        json_ecrire_chaine(sortie, contexte->fichier);
+        fputs(",\"instance\":", sortie);
+        json_ecrire_chaine(sortie, nom);
+        if (instance) fprintf(sortie, ",\"dimension\":%d", instance->dimension);
+        else fputs(",\"dimension\":null", sortie);
+        fprintf(sortie, ",\"methode\":\"%s\",\"longueur\":", methode);
+        ecrire_nombre(sortie, format, tournee, tournee ? tournee->distanceTotale : 0.0);
+        fputs(",\"temps\":", sortie);
+        ecrire_nombre(sortie, format, tournee, temps);
+        fputs(",\"preparation\":", sortie);
+        ecrire_nombre(sortie, format, instance, contexte->preparation);
+        fputs(",\"borne\":", sortie);
+        ecrire_nombre(sortie, format, avec_borne, avec_borne ? instance->borne_inferieure : 0.0);
+        fprintf(sortie, ",\"statut\":\"%s\"}\n", statut);
+    }
+}
+
+// Résout toutes les méthodes de l'entrée et écrit leurs lignes ; retourne false si l'une a échoué
+static bool traiter_instance(const EntreeLot* entree, const ParamsLot* params, FILE* sortie) {
+    ContexteLot contexte;
+    FonctionDistance dist_func = NULL;
+    double debut = temps_mur();
+    // Candidats partagés dès que plusieurs méthodes de l'entrée s'en servent
+    int nb_avec_candidats = 0;
+    for (int m = 0; m < entree->nb_methodes; m++) {
+        if (methode_utilise_candidats(entree->methodes[m])) nb_avec_candidats++;
+    }
+    InstanceTSP* instance = lire_fichier_tsplib(entree->fichier);
+    if (instance && !preparer_instance(instance, params->avec_alpha, params->renumeroter_hilbert,
+                                       nb_avec_candidats > 1, &dist_func)) {
+        liberer_instance(instance);
+        instance = NULL;
+    }
+    contexte.fichier = entree->fichier;
+    contexte.instance = instance;
+    contexte.preparation = temps_mur() - debut;
+    contexte.avec_borne = instance && params->avec_alpha && instance->candidats;
+
+    bool ok = instance != NULL;
+    for (int m = 0; m < entree->nb_methodes; m++) {
+        Tournee* tournee = NULL;
+        double temps = 0.0;
+        if (instance) {
+            tournee = resoudre_methode(instance, dist_func, entree->methodes[m], &params->methode, &temps);
+        }
+        ecrire_resultat(sortie, params->format, &contexte, entree->methodes[m], tournee, temps);
+        if (!tournee) ok = false;
+        liberer_tournee(tournee);
+    }
+    liberer_instance(instance);
+    return ok;
+}
+
+static void* thread_lot(void* arg) {
+    TravailLot* travail = (TravailLot*)arg;
+    for (;;) {
+        pthread_mutex_lock(&travail->verrou);
+        int i = travail->prochaine++;
+        pthread_mutex_unlock(&travail->verrou);
+        if (i >= travail->nb_entrees) break;
+
+        ResultatLot* resultat = &travail->resultats[i];
+        char* texte = NULL;
+        size_t taille = 0;
+        bool echec = true;
+        FILE* tampon = open_memstream(&texte, &taille);
+        if (tampon) {
+            echec = !traiter_instance(&travail->entrees[i], travail->params, tampon);
+            fclose(tampon);
+        }
+
+        pthread_mutex_lock(&travail->verrou);
+        resultat->texte = texte;
+        resultat->taille = taille;
+        resultat->echec = echec || !texte;
+        resultat->termine = true;
+        pthread_cond_broadcast(&travail->termine);
+        pthread_mutex_unlock(&travail->verrou);
+    }
+    return NULL;
+}
+
+int executer_lot(const char* manifeste, const ParamsLot* params, FILE* sortie) {
+    int nb_entrees = 0;
+    EntreeLot* entrees = lire_manifeste(manifeste, params->methodes_defaut, &nb_entrees);
+    if (!entrees) return -1;
+
+    int nb_threads = nb_threads_effectif(params->nb_instances_paralleles);
+    if (nb_threads > nb_entrees) nb_threads = nb_entrees;
+
+    TravailLot travail;
+    travail.entrees = entrees;
+    travail.nb_entrees = nb_entrees;
+    travail.params = params;
+    travail.resultats = (ResultatLot*)calloc(nb_entrees, sizeof(ResultatLot));
+    travail.prochaine = 0;
+    pthread_t* threads = (pthread_t*)malloc(nb_threads * sizeof(pthread_t));
+    if (!travail.resultats || !threads) {
+        free(travail.resultats);
+        free(threads);
+        liberer_entrees(entrees, nb_entrees);
+        return -1;
+    }
+    pthread_mutex_init(&travail.verrou, NULL);
+    pthread_cond_init(&travail.termine, NULL);
+
+    int nb_lances = 0;
+    while (nb_lances < nb_threads
+           && pthread_create(&threads[nb_lances], NULL, thread_lot, &travail) == 0) {
+        nb_lances++;
+    }
+    if (nb_lances == 0) {
+        // Création de thread impossible : traitement dans le thread appelant
+        thread_lot(&travail);
+    }
+
+    // Écriture dans l'ordre du manifeste, dès que chaque instance est terminée
+    ecrire_entete(sortie, params->format);
+    fflush(sortie);
+    bool echec = false;
+    for (int i = 0; i < nb_entrees; i++) {
+        pthread_mutex_lock(&travail.verrou);
+        while (!travail.resultats[i].termine) {
+            pthread_cond_wait(&travail.termine, &travail.verrou);
+        }
+        pthread_mutex_unlock(&travail.verrou);
+        if (travail.resultats[i].texte) {
+            fwrite(travail.resultats[i].texte, 1, travail.resultats[i].taille, sortie);
+            fflush(sortie);
+        }
+        echec = echec || travail.resultats[i].echec;
+        free(travail.resultats[i].texte);
+    }
+
+    for (int t = 0; t < nb_lances; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    pthread_cond_destroy(&travail.termine);
+    pthread_mutex_destroy(&travail.verrou);
+    free(threads);
+    free(travail.resultats);
+    liberer_entrees(entrees, nb_entrees);
+    return echec ? 1 : 0;
+}
@@ -0,0 +1,32 @@
+#ifndef LOT_H
+#define LOT_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "methodes.h"
+
+typedef enum {
+    FORMAT_LOT_CSV,         // En-tête puis une ligne par (instance, méthode)
+    FORMAT_LOT_JSON         // Un objet JSON par ligne (JSON Lines)
+} FormatLot;
+
+typedef struct {
+    ParamsMethode methode;          // -g -r -j -k -t, appliqués à chaque méthode
+    const char* methodes_defaut;    // -m : méthodes des lignes qui n'en donnent pas (séparées par des virgules)
+    bool avec_alpha;                // -a : borne et candidats calculés une fois par instance
+    bool renumeroter_hilbert;       // -H
+    int nb_instances_paralleles;    // --batch-jobs : instances traitées en même temps (0 = tous les cœurs)
+    FormatLot format;
+} ParamsLot;
+
+/**
+ * Mode lot : chaque ligne du manifeste "fichier [methode ...]" (méthodes séparées
+ * par des espaces ou des virgules, '#' pour les commentaires) est chargée une
+ * seule fois, sa matrice (et ses candidats avec -a) servant à toutes ses méthodes.
+ * Les lignes de résultats sont écrites sur 'sortie' dans l'ordre du manifeste,
+ * même quand plusieurs instances sont traitées en parallèle.
+ * Retourne 0 si toutes les résolutions ont abouti, 1 sinon (-1 : manifeste invalide).
+ */
+int executer_lot(const char* manifeste, const ParamsLot* params, FILE* sortie);
+
+#endif
@@ -18,51 +18,22 @@
 #include "matrice.h"
 
 
-Tournee* marche_aleatoire(const InstanceTSP* instance, FonctionDistance dist_func) {
+Tournee* marche_aleatoire(const InstanceTSP* instance, FonctionDistance dist_func, Alea* alea) {
     int n = instance->dimension;
     Tournee* tournee = creer_tournee(n);
     if (!tournee) return NULL;
 
-    int* est_visitee = (int*)calloc(n, sizeof(int));
-    if (!est_visitee) {
-        liberer_tournee(tournee);
-        return NULL;
+    // La ville 1 reste en tête, les autres sont mélangées (Fisher-Yates)
+    for (int i = 0; i < n; i++) {
+        tournee->chemin[i] = i + 1;
     }
-
-    int ville_courante = 1;
-
-    tournee->chemin[0] = ville_courante;
-    est_visitee[ville_courante - 1] = 1;
-
-    int villes_restantes = n - 1;
-
-    for (int i = 1; i < n; i++) {
-        int* disponibles = (int*)malloc(villes_restantes * sizeof(int));
-        if (!disponibles) {
-            liberer_tournee(tournee);
-            free(est_visitee);
-            return NULL;
-        }
-
-        int k = 0;
-        for (int j = 1; j <= n; j++) {
-            if (!est_visitee[j - 1]) {
-                disponibles[k++] = j;
-            }
-        }
-
-        int index_aleatoire = rand() % villes_restantes;
-        int prochaine_ville = disponibles[index_aleatoire];
-
-        tournee->chemin[i] = prochaine_ville;
-        est_visitee[prochaine_ville - 1] = 1;
-        ville_courante = prochaine_ville;
-        villes_restantes--;
-
-        free(disponibles);
+    for (int i = n - 1; i > 1; i--) {
+        int j = 1 + alea_entier(alea, i);
+        int temp = tournee->chemin[i];
+        tournee->chemin[i] = tournee->chemin[j];
+        tournee->chemin[j] = temp;
     }
     calculer_longueur_tournee(tournee, instance, dist_func);
 
-    free(est_visitee);
     return tournee;
 }
\ No newline at end of file
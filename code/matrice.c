@@ -1,6 +1,8 @@
 #include "matrice.h"
+#include "instance_binaire.h"
+#include "mesures.h"
 
-void calculer_matrice_distances(InstanceTSP* instance, FonctionDistance fonc_dist) {
+bool allouer_matrice_distances(InstanceTSP* instance) {
     // Si une matrice existe déjà, la libérer d'abord
     if (instance->matrice_existe) {
         liberer_matrice_distances(instance);
@@ -8,29 +10,47 @@ void calculer_matrice_distances(InstanceTSP* instance, FonctionDistance fonc_dis
 
     int n = instance->dimension;
     instance->matrice_distances = (double**)malloc(n * sizeof(double*));
+    // Un seul bloc contigu de n(n-1)/2 distances : la ligne i commence à i(i-1)/2
+    double* bloc = (n > 1) ? (double*)malloc((size_t)n * (n - 1) / 2 * sizeof(double)) : NULL;
+    if (!instance->matrice_distances || (n > 1 && !bloc)) {
+        free(instance->matrice_distances);
+        free(bloc);
+        instance->matrice_distances = NULL;
+        return false;
+    }
 
-    // Matrice triangulaire inférieure "jagged"
-    for (int i = 0; i < n; i++) {
-        // La ligne 'i' a 'i' colonnes (pour 0 à i-1)
-        if (i == 0) {
-            instance->matrice_distances[i] = NULL;
-        } else {
-            instance->matrice_distances[i] = (double*)malloc(i * sizeof(double));
-            // Calculer les distances pour cette ligne
-            for (int j = 0; j < i; j++) {
-                instance->matrice_distances[i][j] = fonc_dist(&instance->villes[i], &instance->villes[j]);
-            }
-        }
+    // Matrice triangulaire inférieure "jagged" : la ligne 'i' a 'i' colonnes (pour 0 à i-1)
+    instance->matrice_distances[0] = NULL;
+    for (int i = 1; i < n; i++) {
+        instance->matrice_distances[i] = bloc + (size_t)i * (i - 1) / 2;
     }
     instance->matrice_existe = true;
+    return true;
+}
+
+void calculer_matrice_distances(InstanceTSP* instance, FonctionDistance fonc_dist) {
+    // Distances explicites : lues dans le fichier, il n'y a rien à calculer
+    if (instance->type_distance == DIST_EXPLICIT && instance->matrice_existe) {
+        return;
+    }
+    if (!allouer_matrice_distances(instance)) {
+        return;
+    }
+
+    int n = instance->dimension;
+    for (int i = 1; i < n; i++) {
+        // Calculer les distances pour cette ligne
+        for (int j = 0; j < i; j++) {
+            instance->matrice_distances[i][j] = fonc_dist(&instance->villes[i], &instance->villes[j]);
+        }
+    }
 }
 
 void liberer_matrice_distances(InstanceTSP* instance) {
     if (instance && instance->matrice_existe) {
-        for (int i = 0; i < instance->dimension; i++) {
-            if (instance->matrice_distances[i]) {
-                free(instance->matrice_distances[i]);
-            }
+        // Le bloc des distances commence à la ligne 1 (dans la projection d'une instance binaire)
+        if (instance->dimension > 1 && !instance_binaire_contient(instance, instance->matrice_distances[1])) {
+            free(instance->matrice_distances[1]);
         }
         free(instance->matrice_distances);
         instance->matrice_distances = NULL;
@@ -40,6 +60,7 @@ void liberer_matrice_distances(InstanceTSP* instance) {
 
 // i et j sont 0-indexés
 double obtenir_distance_matrice(const InstanceTSP* instance, int i, int j) {
+    MESURES_COMPTER(COMPTEUR_LECTURES_MATRICE, 1);
     if (i == j) return 0.0;
     
     // Assurer i > j pour lire la matrice triangulaire inférieure
@@ -50,4 +71,11 @@ double obtenir_distance_matrice(const InstanceTSP* instance, int i, int j) {
     }
     
     return instance->matrice_distances[i][j];
+}
+
+double distance_villes(const InstanceTSP* instance, FonctionDistance dist_func, int i, int j) {
+    if (instance->matrice_existe) {
+        return obtenir_distance_matrice(instance, i, j);
+    }
+    return dist_func(&instance->villes[i], &instance->villes[j]);
 }
\ No newline at end of file
@@ -3,7 +3,15 @@
 
 #include "tsp.h"
 
+// Au-delà, la matrice (n²/2 doubles) n'est pas calculée et les distances sont calculées à la volée
+#define DIMENSION_MAX_MATRICE 15000
+
+// Alloue la matrice des distances sans la remplir (lignes de longueur croissante
+// rangées dans un seul bloc contigu) ; faux en cas d'échec d'allocation
+bool allouer_matrice_distances(InstanceTSP* instance);
+
 // Prend une fonction de distance et calcule la matrice des distances
+// (sans effet sur une instance EXPLICIT, dont la matrice vient du fichier)
 void calculer_matrice_distances(InstanceTSP* instance, FonctionDistance fonc_dist);
 
 // Libère la mémoire allouée pour la matrice des distances
@@ -12,4 +20,8 @@ void liberer_matrice_distances(InstanceTSP* instance);
 // Obtient la distance entre les villes i et j à partir de la matrice
 double obtenir_distance_matrice(const InstanceTSP* instance, int i, int j);
 
+// Distance entre les villes i et j (0-indexés) : lue dans la matrice si elle existe,
+// calculée avec dist_func sinon
+double distance_villes(const InstanceTSP* instance, FonctionDistance dist_func, int i, int j);
+
 #endif
\ No newline at end of file
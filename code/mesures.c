@@ -0,0 +1,184 @@
+/**
+ * mesures.c
+ * Chronomètres des phases, compteurs par thread, mémoire maximale ; résumé et JSON
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/resource.h>
+
+#include "mesures.h"
+#include "chrono.h"
+
+/*  Chaque thread compte dans son propre bloc (aucune ligne de cache partagée dans
+    les boucles parallèles). Les blocs, chaînés à leur création, sont additionnés à
+    la lecture ; à la sortie d'un thread, ses comptes sont reportés et son bloc libéré. */
+typedef struct CompteursThread {
+    unsigned long long valeurs[NB_COMPTEURS];
+    struct CompteursThread* suivant;
+} CompteursThread;
+
+bool mesures_actives = false;
+
+static __thread CompteursThread* compteurs_thread = NULL;
+
+static CompteursThread* premier_bloc = NULL;
+static pthread_mutex_t verrou_blocs = PTHREAD_MUTEX_INITIALIZER;
+// Comptes des threads terminés (leurs blocs sont libérés à leur sortie)
+static unsigned long long compteurs_termines[NB_COMPTEURS];
+// Bloc partagé si l'allocation d'un thread échoue (comptes approximatifs)
+static CompteursThread bloc_secours;
+static pthread_key_t cle_bloc;
+static pthread_once_t cle_bloc_creee = PTHREAD_ONCE_INIT;
+
+static const char* const NOMS_PHASES[NB_PHASES] = {
+    "lecture", "matrice", "candidats", "construction", "amelioration", "sortie"
+};
+static const char* const NOMS_COMPTEURS[NB_COMPTEURS] = {
+    "distances", "lectures_matrice", "2opt_essais", "2opt_appliques", "croisements", "enfants_rejetes"
+};
+
+typedef struct {
+    double mur;
+    double cpu;
+    double debut_mur;
+    double debut_cpu;
+    int appels;
+} Chronometre;
+
+static Chronometre phases[NB_PHASES];
+static double debut_processus_mur = 0.0;
+static bool rapport_resume = false;
+static const char* rapport_json = NULL;
+
+/*  Sortie d'un thread : ses comptes passent dans compteurs_termines. Les threads des
+    passes du 2-opt parallèle sont recréés à chaque passe : sans cela, les blocs
+    s'accumuleraient pendant toute la recherche. */
+static void retirer_bloc(void* arg) {
+    CompteursThread* bloc = (CompteursThread*)arg;
+    pthread_mutex_lock(&verrou_blocs);
+    for (int c = 0; c < NB_COMPTEURS; c++) {
+        compteurs_termines[c] += bloc->valeurs[c];
+    }
+    CompteursThread** lien = &premier_bloc;
+    while (*lien != bloc) lien = &(*lien)->suivant;
+    *lien = bloc->suivant;
+    pthread_mutex_unlock(&verrou_blocs);
+    free(bloc);
+}
+
+static void creer_cle_bloc(void) {
+    pthread_key_create(&cle_bloc, retirer_bloc);
+}
+
+static CompteursThread* compteurs_thread_creer(void) {
+    pthread_once(&cle_bloc_creee, creer_cle_bloc);
+    CompteursThread* bloc = (CompteursThread*)calloc(1, sizeof(CompteursThread));
+    if (!bloc) return compteurs_thread = &bloc_secours;
+    pthread_mutex_lock(&verrou_blocs);
+    bloc->suivant = premier_bloc;
+    premier_bloc = bloc;
+    pthread_mutex_unlock(&verrou_blocs);
+    pthread_setspecific(cle_bloc, bloc);
+    return compteurs_thread = bloc;
+}
+
+// Seul le thread propriétaire écrit dans son bloc : pas d'instruction verrouillée
+void mesures_compter(Compteur compteur, unsigned long long n) {
+    CompteursThread* bloc = compteurs_thread ? compteurs_thread : compteurs_thread_creer();
+    unsigned long long* valeur = &bloc->valeurs[compteur];
+    __atomic_store_n(valeur, __atomic_load_n(valeur, __ATOMIC_RELAXED) + n, __ATOMIC_RELAXED);
+}
+
+unsigned long long mesures_compteur(Compteur compteur) {
+    unsigned long long total = __atomic_load_n(&bloc_secours.valeurs[compteur], __ATOMIC_RELAXED);
+    pthread_mutex_lock(&verrou_blocs);
+    total += compteurs_termines[compteur];
+    for (CompteursThread* bloc = premier_bloc; bloc; bloc = bloc->suivant) {
+        total += __atomic_load_n(&bloc->valeurs[compteur], __ATOMIC_RELAXED);
+    }
+    pthread_mutex_unlock(&verrou_blocs);
+    return total;
+}
+
+// Temps CPU cumulé de tous les threads du processus, à la nanoseconde
+static double temps_cpu(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+void phase_debut(Phase phase) {
+    phases[phase].debut_mur = temps_mur();
+    phases[phase].debut_cpu = temps_cpu();
+}
+
+double phase_fin(Phase phase) {
+    double duree = temps_mur() - phases[phase].debut_mur;
+    phases[phase].mur += duree;
+    phases[phase].cpu += temps_cpu() - phases[phase].debut_cpu;
+    phases[phase].appels++;
+    return duree;
+}
+
+long memoire_max_ko(void) {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return -1;
+    return usage.ru_maxrss;        // Ko sous Linux
+}
+
+static void afficher_resume(FILE* flux) {
+    fprintf(flux, "Mesures :\n");
+    fprintf(flux, "  %-14s %12s %12s\n", "phase", "mur (s)", "cpu (s)");
+    for (int p = 0; p < NB_PHASES; p++) {
+        if (phases[p].appels == 0) continue;
+        fprintf(flux, "  %-14s %12.6f %12.6f\n", NOMS_PHASES[p], phases[p].mur, phases[p].cpu);
+    }
+    fprintf(flux, "  %-14s %12.6f %12.6f\n", "total", temps_mur() - debut_processus_mur, temps_cpu());
+    for (int c = 0; c < NB_COMPTEURS; c++) {
+        fprintf(flux, "  %-18s %llu\n", NOMS_COMPTEURS[c], mesures_compteur((Compteur)c));
+    }
+    fprintf(flux, "  %-18s %ld Ko\n", "rss_max", memoire_max_ko());
+}
+
+static void ecrire_json(FILE* flux) {
+    fprintf(flux, "{\"phases\":{");
+    for (int p = 0; p < NB_PHASES; p++) {
+        fprintf(flux, "%s\"%s\":{\"mur\":%.6f,\"cpu\":%.6f,\"appels\":%d}", p ? "," : "", NOMS_PHASES[p],
+                phases[p].mur, phases[p].cpu, phases[p].appels);
+    }
+    fprintf(flux, "},\"total\":{\"mur\":%.6f,\"cpu\":%.6f},\"compteurs\":{",
+            temps_mur() - debut_processus_mur, temps_cpu());
+    for (int c = 0; c < NB_COMPTEURS; c++) {
+        fprintf(flux, "%s\"%s\":%llu", c ? "," : "", NOMS_COMPTEURS[c], mesures_compteur((Compteur)c));
+    }
+    fprintf(flux, "},\"rss_max_ko\":%ld}\n", memoire_max_ko());
+}
+
+static void ecrire_rapport(void) {
+    fflush(stdout);
+    if (rapport_resume) afficher_resume(stderr);
+    if (!rapport_json) return;
+    FILE* flux = stdout;
+    if (rapport_json[0] != '-' || rapport_json[1] != '\0') {
+        flux = fopen(rapport_json, "w");
+        if (!flux) {
+            perror("Erreur écriture des mesures");
+            return;
+        }
+    }
+    ecrire_json(flux);
+    if (flux != stdout) fclose(flux);
+    else fflush(stdout);
+}
+
+void mesures_rapport_a_la_sortie(bool resume, const char* fichier_json) {
+    // Le temps total écoulé part de cet appel, juste après la lecture des options
+    debut_processus_mur = temps_mur();
+    rapport_resume = resume;
+    rapport_json = fichier_json;
+    mesures_actives = resume || fichier_json;
+    if (mesures_actives) atexit(ecrire_rapport);
+}
@@ -0,0 +1,53 @@
+#ifndef MESURES_H
+#define MESURES_H
+
+#include <stdbool.h>
+
+// Phases d'une exécution, chronométrées en temps écoulé et en temps CPU du processus
+typedef enum {
+    PHASE_LECTURE,          // Instance et tournées lues
+    PHASE_MATRICE,          // Matrice des distances
+    PHASE_CANDIDATS,        // Borne de Held-Karp et candidats alpha (-a)
+    PHASE_CONSTRUCTION,     // Tournée initiale (nn, greedy, ..., aco, bf)
+    PHASE_AMELIORATION,     // 2-opt, sa, ils, ga, decomp, portfolio, réparation --delta
+    PHASE_SORTIE,           // Ligne Tour : et fichiers -o, --tour-bin
+    NB_PHASES
+} Phase;
+
+typedef enum {
+    COMPTEUR_DISTANCES,         // Distances calculées (EUCL_2D, GEO, ATT)
+    COMPTEUR_LECTURES_MATRICE,  // Distances lues dans la matrice
+    COMPTEUR_2OPT_ESSAIS,       // Mouvements 2-opt évalués
+    COMPTEUR_2OPT_APPLIQUES,    // Mouvements 2-opt appliqués
+    COMPTEUR_CROISEMENTS,       // Croisements du GA
+    COMPTEUR_ENFANTS_REJETES,   // Enfants du GA pas meilleurs que le pire individu
+    NB_COMPTEURS
+} Compteur;
+
+// Compteurs tenus seulement si des mesures sont demandées (--stats, --stats-json) :
+// sinon, un test de booléen par appel dans les fonctions de distance
+extern bool mesures_actives;
+
+#define MESURES_COMPTER(compteur, n) \
+    do { if (mesures_actives) mesures_compter((compteur), (n)); } while (0)
+
+// Ajoute n au compteur dans le bloc du thread appelant (créé au premier appel)
+void mesures_compter(Compteur compteur, unsigned long long n);
+
+// Somme des blocs de tous les threads
+unsigned long long mesures_compteur(Compteur compteur);
+
+/*  Chronomètres des phases (thread principal), temps écoulé sur l'horloge monotone et
+    temps CPU du processus. Une phase peut être ouverte plusieurs fois : les durées
+    s'additionnent. phase_fin retourne le temps écoulé depuis phase_debut. */
+void phase_debut(Phase phase);
+double phase_fin(Phase phase);
+
+// Mémoire résidente maximale du processus (getrusage), en Ko
+long memoire_max_ko(void);
+
+/*  Rapport écrit à la sortie du programme (atexit) : résumé sur stderr si 'resume',
+    JSON dans 'fichier_json' ("-" : sortie standard) s'il n'est pas NULL. */
+void mesures_rapport_a_la_sortie(bool resume, const char* fichier_json);
+
+#endif
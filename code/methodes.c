@@ -0,0 +1,321 @@
+/**
+ * methodes.c
+ * Résolution par nom de méthode, sans affichage (ligne de commande, bibliothèque, lots)
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <pthread.h>
+
+#include "methodes.h"
+#include "heuristiques.h"
+#include "tsp_utils.h"
+#include "force_brute.h"
+#include "ga_generique.h"
+#include "hilbert.h"
+#include "multi_depart.h"
+#include "recuit.h"
+#include "ils.h"
+#include "aco.h"
+#include "decomposition.h"
+#include "portfolio.h"
+#include "parallele.h"
+#include "chrono.h"
+#include "parser.h"
+#include "distance.h"
+#include "matrice.h"
+#include "candidats.h"
+#include "alpha.h"
+#include "mesures.h"
+
+static const char* const METHODES[] = {
+    "bf", "nn", "2optnn", "rw", "2optrw", "greedy", "2optgreedy", "hilbert", "2opthilbert",
+    "mst", "2optmst", "sa", "ils", "aco", "decomp", "portfolio", "ga", "gadpx", NULL
+};
+
+void params_methode_defaut(ParamsMethode* params) {
+    params->avec_grille = false;
+    params->nb_runs = 1;
+    params->nb_threads = 1;
+    params->nb_perturbations = 0;
+    params->duree = 0.0;
+    params->nb_individus = 30;
+    params->nb_generations = 1000;
+    params->taux_mutation = 0.10;
+    params->graine = 0;
+    params->tournee_initiale = NULL;
+    params->checkpoint = NULL;
+    params->avec_phases = false;
+    params->resume_multi_depart = NULL;
+    params->resume_portfolio = NULL;
+}
+
+bool methode_existe(const char* methode) {
+    for (int m = 0; METHODES[m]; m++) {
+        if (strcmp(methode, METHODES[m]) == 0) return true;
+    }
+    return false;
+}
+
+bool methode_utilise_candidats(const char* methode) {
+    return strcmp(methode, "sa") == 0 || strcmp(methode, "ils") == 0 || strcmp(methode, "aco") == 0
+        || strcmp(methode, "decomp") == 0 || strcmp(methode, "portfolio") == 0;
+}
+
+bool preparer_instance(InstanceTSP* instance, bool avec_alpha, bool renumeroter_hilbert,
+                       bool candidats_partages, FonctionDistance* dist_func) {
+    if (renumeroter_hilbert) {
+        if (instance->type_distance == DIST_EXPLICIT) {
+            fprintf(stderr, "Erreur: %s : '-H' utilise les coordonnées des villes, absentes d'une "
+                    "instance EXPLICIT.\n", instance->nom);
+            return false;
+        }
+        renumeroter_villes_hilbert(instance);
+    }
+    *dist_func = obtenir_fonction_distance(instance->type_distance);
+    if (!*dist_func) return false;
+    if (!instance->matrice_existe && instance->dimension <= DIMENSION_MAX_MATRICE) {
+        calculer_matrice_distances(instance, *dist_func);
+    }
+    if (instance->candidats && !avec_alpha) {
+        retirer_candidats_instance(instance);
+        instance->borne_inferieure = 0.0;
+    } else if (avec_alpha && !instance->candidats) {
+        bool borne_exacte;
+        instance->candidats = calculer_candidats_alpha(instance, *dist_func, NB_CANDIDATS_DEFAUT,
+                                                       &instance->borne_inferieure, &borne_exacte);
+    }
+    // Échec d'allocation : chaque méthode calcule ses propres candidats
+    if (candidats_partages && !avec_alpha) {
+        instance->candidats = calculer_candidats(instance, *dist_func, NB_CANDIDATS_DEFAUT);
+    }
+    return true;
+}
+
+// Méthode "2optxxx" : construction 'xxx' suivie du 2-opt
+static bool avec_2opt(const char* methode) {
+    return strncmp(methode, "2opt", 4) == 0;
+}
+
+// Méthodes qui améliorent une tournée de départ (construction ou tournée -i)
+static bool ameliore_depart(const char* methode) {
+    return avec_2opt(methode) || strcmp(methode, "sa") == 0 || strcmp(methode, "ils") == 0;
+}
+
+// 2optnn/2optrw avec plusieurs runs (-r)
+static bool multi_depart(const char* methode, const ParamsMethode* params) {
+    return params->nb_runs > 1 && (strcmp(methode, "2optnn") == 0 || strcmp(methode, "2optrw") == 0);
+}
+
+// Les phases sont globales (mesures.c) : chronométrées pour la ligne de commande seulement
+static void debut_phase(const ParamsMethode* params, Phase phase) {
+    if (params->avec_phases) phase_debut(phase);
+}
+
+static void fin_phase(const ParamsMethode* params, Phase phase) {
+    if (params->avec_phases) phase_fin(phase);
+}
+
+static void ameliorer(Tournee* tournee, const InstanceTSP* instance, FonctionDistance dist_func,
+                      const ParamsMethode* params) {
+    int threads = nb_threads_effectif(params->nb_threads);
+    if (threads > 1) {
+        deux_opt_parallele(tournee, instance, dist_func, threads);
+    } else {
+        deux_opt(tournee, instance, dist_func);
+    }
+}
+
+static Tournee* construire_nn(const InstanceTSP* instance, FonctionDistance dist_func,
+                              const ParamsMethode* params) {
+    return params->avec_grille ? plus_proche_voisin_grille(instance, dist_func)
+                               : plus_proche_voisin(instance, dist_func);
+}
+
+/*  Tournée de départ de la méthode : copie de la tournée -i pour les méthodes
+    d'amélioration (2opt<construction>, sa, ils), construction sinon */
+static Tournee* construire(const InstanceTSP* instance, FonctionDistance dist_func,
+                           const char* methode, const ParamsMethode* params) {
+    const char* base = avec_2opt(methode) ? methode + 4 : methode;
+
+    if (params->tournee_initiale && ameliore_depart(methode)) {
+        Tournee* tournee = creer_tournee(params->tournee_initiale->taille);
+        if (!tournee) return NULL;
+        copier_tournee(tournee, params->tournee_initiale);
+        return tournee;
+    }
+    if (strcmp(base, "nn") == 0 || strcmp(methode, "sa") == 0 || strcmp(methode, "ils") == 0) {
+        return construire_nn(instance, dist_func, params);
+    } else if (strcmp(base, "rw") == 0) {
+        // Générateur propre à l'appel : résolutions concurrentes reproductibles
+        Alea alea;
+        alea_initialiser(&alea, params->graine ? params->graine : GRAINE_MARCHE_ALEATOIRE);
+        return marche_aleatoire(instance, dist_func, &alea);
+    } else if (strcmp(base, "greedy") == 0) {
+        return glouton_aretes(instance, dist_func);
+    } else if (strcmp(base, "hilbert") == 0) {
+        return courbe_hilbert(instance, dist_func);
+    } else if (strcmp(base, "mst") == 0) {
+        return construction_arbre_couvrant(instance, dist_func);
+    }
+    return NULL;
+}
+
+// La force brute garde son état dans des variables globales (force_brute.c) :
+// une seule à la fois quand plusieurs instances sont résolues en parallèle
+static pthread_mutex_t verrou_force_brute = PTHREAD_MUTEX_INITIALIZER;
+
+static Tournee* force_brute(const InstanceTSP* instance, FonctionDistance dist_func,
+                            const ParamsMethode* params) {
+    if (instance->dimension > FORCE_BRUTE_DIMENSION_MAX && params->duree <= 0.0) {
+        fprintf(stderr, "Erreur: force brute sur %d villes sans durée maximale.\n", instance->dimension);
+        return NULL;
+    }
+    Tournee* meilleure = NULL;
+    Tournee* pire = NULL;
+    pthread_mutex_lock(&verrou_force_brute);
+    // resoudre_force_brute ne modifie pas l'instance
+    if (!resoudre_force_brute((InstanceTSP*)instance, dist_func, &meilleure, &pire)) {
+        liberer_tournee(meilleure);
+        meilleure = NULL;
+    }
+    pthread_mutex_unlock(&verrou_force_brute);
+    liberer_tournee(pire);
+    return meilleure;
+}
+
+static Tournee* genetique(const InstanceTSP* instance, FonctionDistance dist_func,
+                          const ParamsMethode* params, bool dpx) {
+    ParamsGA ga;
+    ga.taille_population = params->nb_individus;
+    ga.nombre_generations = params->duree > 0.0 ? INT_MAX : params->nb_generations;
+    ga.taux_mutation = params->taux_mutation;
+    ga.nb_croisements = params->nb_individus / 2;
+    ga.graine = params->graine ? params->graine : GRAINE_GA;
+    ga.checkpoint = params->checkpoint;
+    ga.tournee_initiale = params->tournee_initiale;
+    Tournee* tournee = algorithme_genetique(instance, dist_func, &ga,
+                                            dpx ? croisement_dpx : croisement_ordonne);
+    if (!tournee) {
+        fprintf(stderr, "Erreur : échec de l'algorithme génétique\n");
+        return NULL;
+    }
+    calculer_longueur_tournee(tournee, instance, dist_func);
+    // Arrêt demandé (SIGTERM) : pas de 2-opt, le point de reprise est écrit
+    if (!checkpoint_arret_demande()) deux_opt(tournee, instance, dist_func);
+    return tournee;
+}
+
+// Méthodes sans construction séparée : une seule phase
+static Tournee* executer_d_un_bloc(const InstanceTSP* instance, FonctionDistance dist_func,
+                                   const char* methode, const ParamsMethode* params) {
+    int nb_threads = nb_threads_effectif(params->nb_threads);
+
+    if (multi_depart(methode, params)) {
+        return multi_depart_2opt(instance, dist_func, strcmp(methode, "2optnn") == 0 ? DEPART_NN : DEPART_RW,
+                                 params->avec_grille, params->nb_runs, nb_threads, params->graine,
+                                 params->resume_multi_depart);
+    } else if (strcmp(methode, "aco") == 0) {
+        ParamsACO aco;
+        params_aco_defaut(&aco);
+        if (params->graine) aco.graine = params->graine;
+        if (params->duree > 0.0) aco.nb_iterations = INT_MAX;
+        return colonie_fourmis(instance, dist_func, &aco, nb_threads);
+    } else if (strcmp(methode, "decomp") == 0) {
+        ParamsDecomposition decomp;
+        params_decomposition_defaut(&decomp);
+        decomp.nb_perturbations = params->nb_perturbations;
+        decomp.nb_threads = nb_threads;
+        return decomposition(instance, dist_func, &decomp);
+    } else if (strcmp(methode, "portfolio") == 0) {
+        ParamsPortfolio course;
+        params_portfolio_defaut(&course);
+        if (params->duree > 0.0) course.duree = params->duree;
+        course.nb_threads = nb_threads;
+        course.avec_grille = params->avec_grille;
+        course.ga.taille_population = params->nb_individus;
+        course.ga.nombre_generations = params->nb_generations;
+        course.ga.taux_mutation = params->taux_mutation;
+        course.ga.nb_croisements = params->nb_individus / 2;
+        if (params->graine) {
+            course.graine = params->graine;
+            course.ga.graine = params->graine;
+        }
+        return portfolio(instance, dist_func, &course, params->resume_portfolio);
+    }
+    return genetique(instance, dist_func, params, strcmp(methode, "gadpx") == 0);
+}
+
+static Tournee* executer(const InstanceTSP* instance, FonctionDistance dist_func,
+                         const char* methode, const ParamsMethode* params) {
+    if (strcmp(methode, "bf") == 0) {
+        return force_brute(instance, dist_func, params);
+    }
+    if (multi_depart(methode, params) || strcmp(methode, "aco") == 0 || strcmp(methode, "decomp") == 0
+        || strcmp(methode, "portfolio") == 0 || strcmp(methode, "ga") == 0
+        || strcmp(methode, "gadpx") == 0) {
+        // La colonie de fourmis construit ses tournées, les autres les améliorent
+        Phase phase = strcmp(methode, "aco") == 0 ? PHASE_CONSTRUCTION : PHASE_AMELIORATION;
+        debut_phase(params, phase);
+        Tournee* tournee = executer_d_un_bloc(instance, dist_func, methode, params);
+        fin_phase(params, phase);
+        return tournee;
+    }
+
+    debut_phase(params, PHASE_CONSTRUCTION);
+    Tournee* tournee = construire(instance, dist_func, methode, params);
+    fin_phase(params, PHASE_CONSTRUCTION);
+    if (!tournee || !ameliore_depart(methode)) {
+        return tournee;
+    }
+
+    debut_phase(params, PHASE_AMELIORATION);
+    if (strcmp(methode, "sa") == 0) {
+        ParamsRecuit recuit;
+        params_recuit_defaut(&recuit);
+        if (params->graine) recuit.graine = params->graine;
+        recuit_simule(tournee, instance, dist_func, &recuit);
+    } else if (strcmp(methode, "ils") == 0) {
+        ParamsILS ils;
+        params_ils_defaut(&ils);
+        if (params->graine) ils.graine = params->graine;
+        // Avec une durée et sans nombre de perturbations : jusqu'à l'échéance
+        ils.nb_perturbations = (params->nb_perturbations <= 0 && params->duree > 0.0)
+                             ? LLONG_MAX : params->nb_perturbations;
+        recherche_locale_iteree(tournee, instance, dist_func, &ils);
+    } else {
+        ameliorer(tournee, instance, dist_func, params);
+    }
+    fin_phase(params, PHASE_AMELIORATION);
+    return tournee;
+}
+
+Tournee* resoudre_methode(const InstanceTSP* instance, FonctionDistance dist_func,
+                          const char* methode, const ParamsMethode* params, double* temps) {
+    if (!methode_existe(methode)) {
+        fprintf(stderr, "Erreur: Méthode '%s' non reconnue.\n", methode);
+        return NULL;
+    }
+    if (instance->type_distance == DIST_EXPLICIT
+        && (strcmp(methode, "hilbert") == 0 || strcmp(methode, "2opthilbert") == 0
+            || strcmp(methode, "decomp") == 0)) {
+        fprintf(stderr, "Erreur: '%s' utilise les coordonnées des villes, absentes d'une instance EXPLICIT.\n",
+                methode);
+        return NULL;
+    }
+
+    double echeance_appelant = echeance_obtenir();
+    if (params->duree > 0.0) {
+        echeance_fixer(params->duree);
+    }
+    double debut = temps_mur();
+    Tournee* tournee = executer(instance, dist_func, methode, params);
+    if (temps) *temps = temps_mur() - debut;
+    echeance_definir(echeance_appelant);
+
+    if (tournee) {
+        calculer_longueur_tournee(tournee, instance, dist_func);
+    }
+    return tournee;
+}
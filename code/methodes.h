@@ -0,0 +1,62 @@
+#ifndef METHODES_H
+#define METHODES_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "tsp.h"
+#include "checkpoint.h"
+#include "multi_depart.h"
+#include "portfolio.h"
+
+// Au-delà, la force brute n'est lancée qu'avec une durée maximale
+#define FORCE_BRUTE_DIMENSION_MAX 12
+
+// Options des méthodes (équivalents des options de la ligne de commande)
+typedef struct {
+    bool avec_grille;               // -g
+    int nb_runs;                    // -r : 2optnn/2optrw multi-départ si > 1
+    int nb_threads;                 // -j : 0 = tous les cœurs
+    long long nb_perturbations;     // -k : ils/decomp (<= 0 : n)
+    double duree;                   // -t : secondes, <= 0 : aucune échéance
+    int nb_individus;               // ga/gadpx/portfolio
+    int nb_generations;
+    double taux_mutation;
+    uint64_t graine;                // rw/sa/ils/aco/ga/gadpx/portfolio ; 0 : graine par défaut de la méthode
+    // Ligne de commande (NULL / false par défaut)
+    const Tournee* tournee_initiale;            // -i : départ de 2opt<construction>, sa, ils, ga, gadpx
+    const ParamsCheckpoint* checkpoint;         // ga/gadpx : points de reprise
+    bool avec_phases;                           // Chronomètres des phases (mesures.h) : thread principal seulement
+    ResumeMultiDepart* resume_multi_depart;     // Reçoit le résumé du multi-départ (-r)
+    ResumePortfolio* resume_portfolio;          // Reçoit le résumé du portfolio
+} ParamsMethode;
+
+void params_methode_defaut(ParamsMethode* params);
+
+// Vrai si 'methode' est une méthode connue (nn, 2optnn, ..., ga, gadpx)
+bool methode_existe(const char* methode);
+
+// Vrai si 'methode' se sert des listes de candidats (sa, ils, aco, decomp, portfolio)
+bool methode_utilise_candidats(const char* methode);
+
+/**
+ * Prépare une instance lue pour plusieurs résolutions, comme la ligne de commande :
+ * renumérotation de Hilbert (-H), matrice des distances, candidats alpha et borne
+ * (-a ; ceux d'une instance binaire sont retirés sans -a). Sans -a, 'candidats_partages'
+ * calcule une fois les candidats géométriques, que les méthodes copient au lieu de les
+ * recalculer (borne nulle). 'dist_func' reçoit la fonction distance. false (message
+ * sur stderr) si l'instance ne s'y prête pas.
+ */
+bool preparer_instance(InstanceTSP* instance, bool avec_alpha, bool renumeroter_hilbert,
+                       bool candidats_partages, FonctionDistance* dist_func);
+
+/**
+ * Résout l'instance avec la méthode 'methode', sans rien afficher, et retourne
+ * la tournée (longueur calculée) ; NULL si la méthode est inconnue, ne s'applique
+ * pas à l'instance (message sur stderr) ou a échoué. Avec une durée, l'échéance
+ * du thread appelant est fixée pendant l'appel puis rétablie. 'temps' (si non
+ * NULL) reçoit le temps écoulé en secondes.
+ */
+Tournee* resoudre_methode(const InstanceTSP* instance, FonctionDistance dist_func,
+                          const char* methode, const ParamsMethode* params, double* temps);
+
+#endif
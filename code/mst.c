@@ -0,0 +1,396 @@
+/**
+ * mst.c
+ * Construction de type Christofides : arbre couvrant minimal (Prim),
+ * couplage glouton des sommets de degré impair, circuit eulérien raccourci
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <float.h>
+
+#include "heuristiques.h"
+#include "tsp_utils.h"
+#include "distance.h"
+#include "matrice.h"
+#include "candidats.h"
+#include "grille.h"
+#include "tas.h"
+
+// En dessous de ce seuil (et si la matrice existe), Prim dense en O(n²)
+#define MST_DIMENSION_MAX_DENSE 2000
+
+// Multigraphe : arêtes de l'arbre puis arêtes du couplage
+typedef struct {
+    int* ville1;
+    int* ville2;
+    int nb_aretes;
+} Multigraphe;
+
+typedef struct {
+    int ville1;
+    int ville2;
+    double distance;
+} PaireCouplage;
+
+// Prim dense sur la matrice : parent[v] pour chaque sommet (parent[0] = -1).
+// Faux si l'allocation échoue.
+static bool prim_dense(const InstanceTSP* instance, FonctionDistance dist_func, int* parent) {
+    int n = instance->dimension;
+    double* cle = (double*)malloc(n * sizeof(double));
+    bool* dans_arbre = (bool*)calloc(n, sizeof(bool));
+    if (!cle || !dans_arbre) {
+        free(cle);
+        free(dans_arbre);
+        return false;
+    }
+
+    for (int v = 0; v < n; v++) {
+        cle[v] = DBL_MAX;
+        parent[v] = -1;
+    }
+    cle[0] = 0.0;
+
+    for (int iter = 0; iter < n; iter++) {
+        int u = -1;
+        for (int v = 0; v < n; v++) {
+            if (!dans_arbre[v] && (u == -1 || cle[v] < cle[u])) u = v;
+        }
+        dans_arbre[u] = true;
+        for (int v = 0; v < n; v++) {
+            if (dans_arbre[v]) continue;
+            double dist = distance_villes(instance, dist_func, u, v);
+            if (dist < cle[v]) {
+                cle[v] = dist;
+                parent[v] = u;
+            }
+        }
+    }
+
+    free(cle);
+    free(dans_arbre);
+    return true;
+}
+
+/**
+ * Prim avec tas binaire sur le graphe des candidats (symétrisé).
+ * Si ce graphe n'est pas connexe, une ville hors de l'arbre est rattachée
+ * à la ville de l'arbre la plus proche et l'algorithme reprend.
+ * Faux si l'allocation échoue.
+ */
+static bool prim_candidats(const InstanceTSP* instance, FonctionDistance dist_func,
+                           const ListesCandidats* candidats, int* parent) {
+    int n = instance->dimension;
+    GrapheCandidats* graphe = creer_graphe_candidats(candidats);
+    TasBinaire* tas = creer_tas(n);
+    bool* dans_arbre = (bool*)calloc(n, sizeof(bool));
+    if (!graphe || !tas || !dans_arbre) {
+        liberer_graphe_candidats(graphe);
+        liberer_tas(tas);
+        free(dans_arbre);
+        return false;
+    }
+    for (int v = 0; v < n; v++) parent[v] = -1;
+
+    int nb_dans_arbre = 0;
+    int prochain_hors_arbre = 0;
+    tas_diminuer(tas, 0, 0.0);
+
+    while (nb_dans_arbre < n) {
+        if (tas->taille == 0) {
+            // Graphe des candidats non connexe : rattacher une nouvelle ville
+            while (dans_arbre[prochain_hors_arbre]) prochain_hors_arbre++;
+            int v = prochain_hors_arbre;
+            double distance_min = DBL_MAX;
+            for (int u = 0; u < n; u++) {
+                if (!dans_arbre[u]) continue;
+                double dist = distance_villes(instance, dist_func, u, v);
+                if (dist < distance_min) {
+                    distance_min = dist;
+                    parent[v] = u;
+                }
+            }
+            tas_diminuer(tas, v, distance_min);
+        }
+
+        int u = tas_extraire(tas);
+        dans_arbre[u] = true;
+        nb_dans_arbre++;
+
+        for (int p = graphe->debut[u]; p < graphe->debut[u + 1]; p++) {
+            int v = graphe->voisins[p];
+            if (dans_arbre[v]) continue;
+            double dist = distance_villes(instance, dist_func, u, v);
+            if (dist < tas->cle[v]) {
+                parent[v] = u;
+                tas_diminuer(tas, v, dist);
+            }
+        }
+    }
+
+    liberer_graphe_candidats(graphe);
+    liberer_tas(tas);
+    free(dans_arbre);
+    return true;
+}
+
+static int comparer_paires(const void* a, const void* b) {
+    const PaireCouplage* p1 = (const PaireCouplage*)a;
+    const PaireCouplage* p2 = (const PaireCouplage*)b;
+    if (p1->distance < p2->distance) return -1;
+    if (p1->distance > p2->distance) return 1;
+    if (p1->ville1 != p2->ville1) return p1->ville1 - p2->ville1;
+    return p1->ville2 - p2->ville2;
+}
+
+/**
+ * Couplage glouton des sommets impairs : chaque sommet propose ses k plus
+ * proches sommets impairs, les paires sont triées et retenues si les deux
+ * sommets sont libres. Les sommets restants sont couplés au plus proche libre.
+ * Faux si l'allocation échoue.
+ */
+static bool coupler_impairs(const InstanceTSP* instance, FonctionDistance dist_func,
+                            const int* impairs, int nb_impairs, Multigraphe* graphe) {
+    int n = instance->dimension;
+    int k = NB_CANDIDATS_DEFAUT;
+    if (k > nb_impairs - 1) k = nb_impairs - 1;
+
+    bool* est_impair = (bool*)calloc(n, sizeof(bool));
+    bool* couple = (bool*)calloc(n, sizeof(bool));
+    int* voisins = (int*)malloc(k * sizeof(int));
+    double* distances = (double*)malloc(k * sizeof(double));
+    PaireCouplage* paires = (PaireCouplage*)malloc((size_t)nb_impairs * k * sizeof(PaireCouplage));
+    if (!est_impair || !couple || !voisins || !distances || !paires) {
+        free(est_impair);
+        free(couple);
+        free(voisins);
+        free(distances);
+        free(paires);
+        return false;
+    }
+    for (int i = 0; i < nb_impairs; i++) est_impair[impairs[i]] = true;
+
+    // Grille restreinte aux sommets impairs
+    GrilleVilles* grille = NULL;
+    if (distance_planaire(instance->type_distance)) {
+        grille = creer_grille(instance, 2);
+        if (grille) {
+            for (int v = 0; v < n; v++) {
+                if (!est_impair[v]) grille_retirer_ville(grille, v);
+            }
+        }
+    }
+
+    int nb_paires = 0;
+    for (int i = 0; i < nb_impairs; i++) {
+        int v = impairs[i];
+        int nb = 0;
+        if (grille) {
+            nb = grille_k_plus_proches(grille, instance, dist_func, v, k, voisins, distances);
+        } else {
+            for (int j = 0; j < nb_impairs; j++) {
+                int w = impairs[j];
+                if (w == v) continue;
+                double dist = distance_villes(instance, dist_func, v, w);
+                if (nb == k && dist >= distances[k - 1]) continue;
+                int pos = (nb < k) ? nb++ : k - 1;
+                while (pos > 0 && distances[pos - 1] > dist) {
+                    distances[pos] = distances[pos - 1];
+                    voisins[pos] = voisins[pos - 1];
+                    pos--;
+                }
+                distances[pos] = dist;
+                voisins[pos] = w;
+            }
+        }
+        for (int r = 0; r < nb; r++) {
+            int w = voisins[r];
+            paires[nb_paires].ville1 = v < w ? v : w;
+            paires[nb_paires].ville2 = v < w ? w : v;
+            paires[nb_paires].distance = distances[r];
+            nb_paires++;
+        }
+    }
+    qsort(paires, nb_paires, sizeof(PaireCouplage), comparer_paires);
+
+    for (int p = 0; p < nb_paires; p++) {
+        int a = paires[p].ville1, b = paires[p].ville2;
+        if (couple[a] || couple[b]) continue;
+        couple[a] = couple[b] = true;
+        graphe->ville1[graphe->nb_aretes] = a;
+        graphe->ville2[graphe->nb_aretes] = b;
+        graphe->nb_aretes++;
+        if (grille) {
+            grille_retirer_ville(grille, a);
+            grille_retirer_ville(grille, b);
+        }
+    }
+
+    // Sommets encore libres : couplage au plus proche sommet libre
+    for (int i = 0; i < nb_impairs; i++) {
+        int a = impairs[i];
+        if (couple[a]) continue;
+        couple[a] = true;
+        int b = -1;
+        if (grille) {
+            grille_retirer_ville(grille, a);
+            b = grille_plus_proche(grille, instance, dist_func, a);
+        } else {
+            double distance_min = DBL_MAX;
+            for (int j = 0; j < nb_impairs; j++) {
+                int w = impairs[j];
+                if (couple[w]) continue;
+                double dist = distance_villes(instance, dist_func, a, w);
+                if (dist < distance_min) {
+                    distance_min = dist;
+                    b = w;
+                }
+            }
+        }
+        if (b == -1) break;
+        couple[b] = true;
+        if (grille) grille_retirer_ville(grille, b);
+        graphe->ville1[graphe->nb_aretes] = a;
+        graphe->ville2[graphe->nb_aretes] = b;
+        graphe->nb_aretes++;
+    }
+
+    liberer_grille(grille);
+    free(est_impair);
+    free(couple);
+    free(voisins);
+    free(distances);
+    free(paires);
+    return true;
+}
+
+/**
+ * Circuit eulérien (Hierholzer, itératif) à partir de la ville 0,
+ * raccourci en ne gardant que la première visite de chaque ville.
+ * Faux si l'allocation échoue.
+ */
+static bool circuit_raccourci(const Multigraphe* graphe, int n, int* chemin) {
+    int m = graphe->nb_aretes;
+    int* debut = (int*)calloc(n + 1, sizeof(int));
+    int* incidentes = (int*)malloc(2 * m * sizeof(int));
+    int* remplissage = (int*)calloc(n, sizeof(int));
+    int* curseur = (int*)malloc(n * sizeof(int));
+    bool* utilisee = (bool*)calloc(m, sizeof(bool));
+    int* pile = (int*)malloc((m + 1) * sizeof(int));
+    bool* visitee = (bool*)calloc(n, sizeof(bool));
+    bool ok = debut && incidentes && remplissage && curseur && utilisee && pile && visitee;
+
+    for (int e = 0; ok && e < m; e++) {
+        debut[graphe->ville1[e] + 1]++;
+        debut[graphe->ville2[e] + 1]++;
+    }
+    for (int v = 0; ok && v < n; v++) debut[v + 1] += debut[v];
+    for (int e = 0; ok && e < m; e++) {
+        int a = graphe->ville1[e], b = graphe->ville2[e];
+        incidentes[debut[a] + remplissage[a]++] = e;
+        incidentes[debut[b] + remplissage[b]++] = e;
+    }
+    for (int v = 0; ok && v < n; v++) curseur[v] = debut[v];
+
+    int sommet_pile = 0;
+    int pos = 0;
+    if (ok) pile[sommet_pile++] = 0;
+    while (sommet_pile > 0) {
+        int v = pile[sommet_pile - 1];
+        while (curseur[v] < debut[v + 1] && utilisee[incidentes[curseur[v]]]) curseur[v]++;
+        if (curseur[v] < debut[v + 1]) {
+            int e = incidentes[curseur[v]++];
+            utilisee[e] = true;
+            pile[sommet_pile++] = (graphe->ville1[e] == v) ? graphe->ville2[e] : graphe->ville1[e];
+        } else {
+            sommet_pile--;
+            if (!visitee[v]) {
+                visitee[v] = true;
+                chemin[pos++] = v + 1;
+            }
+        }
+    }
+
+    free(debut);
+    free(incidentes);
+    free(remplissage);
+    free(curseur);
+    free(utilisee);
+    free(pile);
+    free(visitee);
+    return ok;
+}
+
+/**
+ * Construction par arbre couvrant minimal : Prim (dense sur la matrice pour
+ * les petites instances, tas binaire sur les candidats sinon), couplage glouton
+ * des sommets de degré impair puis circuit eulérien raccourci.
+ */
+Tournee* construction_arbre_couvrant(const InstanceTSP* instance, FonctionDistance dist_func) {
+    int n = instance->dimension;
+    Tournee* tournee = creer_tournee(n);
+    if (!tournee) return NULL;
+
+    if (n < 3) {
+        for (int i = 0; i < n; i++) tournee->chemin[i] = i + 1;
+        calculer_longueur_tournee(tournee, instance, dist_func);
+        return tournee;
+    }
+
+    int* parent = (int*)malloc(n * sizeof(int));
+    int* degre = (int*)calloc(n, sizeof(int));
+    int* impairs = (int*)malloc(n * sizeof(int));
+    Multigraphe graphe;
+    graphe.ville1 = (int*)malloc((n - 1 + n / 2) * sizeof(int));
+    graphe.ville2 = (int*)malloc((n - 1 + n / 2) * sizeof(int));
+    graphe.nb_aretes = 0;
+    if (!parent || !degre || !impairs || !graphe.ville1 || !graphe.ville2) {
+        free(parent); free(degre); free(impairs);
+        free(graphe.ville1); free(graphe.ville2);
+        liberer_tournee(tournee);
+        return NULL;
+    }
+
+    // 1. Arbre couvrant minimal
+    bool ok;
+    if (instance->matrice_existe && n <= MST_DIMENSION_MAX_DENSE) {
+        ok = prim_dense(instance, dist_func, parent);
+    } else {
+        ListesCandidats* candidats = calculer_candidats(instance, dist_func, NB_CANDIDATS_DEFAUT);
+        ok = candidats && prim_candidats(instance, dist_func, candidats, parent);
+        liberer_candidats(candidats);
+    }
+    for (int v = 0; ok && v < n; v++) {
+        if (parent[v] == -1) continue;
+        graphe.ville1[graphe.nb_aretes] = parent[v];
+        graphe.ville2[graphe.nb_aretes] = v;
+        graphe.nb_aretes++;
+        degre[v]++;
+        degre[parent[v]]++;
+    }
+
+    // 2. Couplage des sommets de degré impair
+    int nb_impairs = 0;
+    for (int v = 0; v < n; v++) {
+        if (degre[v] % 2 == 1) impairs[nb_impairs++] = v;
+    }
+    if (ok && nb_impairs > 0) {
+        ok = coupler_impairs(instance, dist_func, impairs, nb_impairs, &graphe);
+    }
+
+    // 3. Circuit eulérien raccourci
+    ok = ok && circuit_raccourci(&graphe, n, tournee->chemin);
+
+    free(parent);
+    free(degre);
+    free(impairs);
+    free(graphe.ville1);
+    free(graphe.ville2);
+    if (!ok) {
+        liberer_tournee(tournee);
+        return NULL;
+    }
+    calculer_longueur_tournee(tournee, instance, dist_func);
+    return tournee;
+}
@@ -0,0 +1,173 @@
+/**
+ * multi_depart.c
+ * 2-opt multi-départ parallèle (pthreads) avec réduction du meilleur résultat
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "multi_depart.h"
+#include "heuristiques.h"
+#include "tsp_utils.h"
+#include "alea.h"
+#include "chrono.h"
+
+#define GRAINE_MULTI_DEPART 12345
+
+// Données partagées par les threads
+typedef struct {
+    const InstanceTSP* instance;
+    FonctionDistance dist_func;
+    TypeDepart type;
+    bool avecGrille;
+    int nb_runs;
+    uint64_t graine;            // Graine des marches aléatoires : graine + numéro du run
+    int prochain_run;           // Prochain run à distribuer (protégé par 'verrou')
+    pthread_mutex_t verrou;
+    double* longueurs;          // Longueur obtenue par chaque run (< 0 : run non exécuté)
+    double echeance;            // Échéance du thread appelant, reprise par chaque thread
+} TravailMultiDepart;
+
+// Résultat propre à chaque thread
+typedef struct {
+    TravailMultiDepart* travail;
+    Tournee* meilleure;
+    int run_meilleure;
+} ThreadMultiDepart;
+
+static Tournee* executer_run(const TravailMultiDepart* travail, int run) {
+    const InstanceTSP* instance = travail->instance;
+    Tournee* tournee;
+
+    if (travail->type == DEPART_NN) {
+        int depart = run % instance->dimension;
+        tournee = travail->avecGrille
+                ? plus_proche_voisin_grille_depuis(instance, travail->dist_func, depart)
+                : plus_proche_voisin_depuis(instance, travail->dist_func, depart);
+    } else {
+        // Graine dépendant uniquement du numéro de run : résultat indépendant du nombre de threads
+        Alea alea;
+        alea_initialiser(&alea, travail->graine + (uint64_t)run);
+        tournee = marche_aleatoire(instance, travail->dist_func, &alea);
+    }
+    if (tournee) {
+        deux_opt(tournee, instance, travail->dist_func);
+    }
+    return tournee;
+}
+
+static void* thread_multi_depart(void* arg) {
+    ThreadMultiDepart* donnees = (ThreadMultiDepart*)arg;
+    TravailMultiDepart* travail = donnees->travail;
+    echeance_definir(travail->echeance);
+
+    while (1) {
+        pthread_mutex_lock(&travail->verrou);
+        int run = travail->prochain_run++;
+        pthread_mutex_unlock(&travail->verrou);
+        // Le run 0 est toujours exécuté : il y a au moins une tournée à l'échéance
+        if (run >= travail->nb_runs || (run > 0 && echeance_atteinte())) break;
+
+        Tournee* tournee = executer_run(travail, run);
+        if (!tournee) continue;
+        travail->longueurs[run] = tournee->distanceTotale;
+
+        if (!donnees->meilleure || tournee->distanceTotale < donnees->meilleure->distanceTotale
+            || (tournee->distanceTotale == donnees->meilleure->distanceTotale
+                && run < donnees->run_meilleure)) {
+            liberer_tournee(donnees->meilleure);
+            donnees->meilleure = tournee;
+            donnees->run_meilleure = run;
+        } else {
+            liberer_tournee(tournee);
+        }
+    }
+    return NULL;
+}
+
+Tournee* multi_depart_2opt(const InstanceTSP* instance, FonctionDistance dist_func,
+                           TypeDepart type, bool avecGrille, int nb_runs, int nb_threads,
+                           uint64_t graine, ResumeMultiDepart* resume) {
+    if (nb_runs < 1) nb_runs = 1;
+    if (nb_threads < 1) nb_threads = 1;
+    if (nb_threads > nb_runs) nb_threads = nb_runs;
+
+    TravailMultiDepart travail;
+    travail.instance = instance;
+    travail.dist_func = dist_func;
+    travail.type = type;
+    travail.avecGrille = avecGrille;
+    travail.nb_runs = nb_runs;
+    travail.graine = graine ? graine : GRAINE_MULTI_DEPART;
+    travail.prochain_run = 0;
+    travail.longueurs = (double*)malloc(nb_runs * sizeof(double));
+    travail.echeance = echeance_obtenir();
+    pthread_mutex_init(&travail.verrou, NULL);
+
+    pthread_t* threads = (pthread_t*)malloc(nb_threads * sizeof(pthread_t));
+    ThreadMultiDepart* donnees = (ThreadMultiDepart*)calloc(nb_threads, sizeof(ThreadMultiDepart));
+    if (!travail.longueurs || !threads || !donnees) {
+        free(travail.longueurs);
+        free(threads);
+        free(donnees);
+        pthread_mutex_destroy(&travail.verrou);
+        return NULL;
+    }
+
+    for (int r = 0; r < nb_runs; r++) travail.longueurs[r] = -1.0;
+    for (int t = 0; t < nb_threads; t++) {
+        donnees[t].travail = &travail;
+        donnees[t].meilleure = NULL;
+        donnees[t].run_meilleure = -1;
+    }
+    // Les runs sont distribués à la demande : si un thread ne peut être créé, ce
+    // thread prend sa place et les runs restants sont faits par les threads lancés
+    int nb_lances = 0;
+    while (nb_lances < nb_threads
+           && pthread_create(&threads[nb_lances], NULL, thread_multi_depart, &donnees[nb_lances]) == 0) {
+        nb_lances++;
+    }
+    if (nb_lances < nb_threads) thread_multi_depart(&donnees[nb_lances]);
+
+    // Réduction : meilleure longueur, à égalité le plus petit numéro de run
+    Tournee* meilleure = NULL;
+    int run_meilleure = -1;
+    for (int t = 0; t < nb_threads; t++) {
+        if (t < nb_lances) pthread_join(threads[t], NULL);
+        Tournee* candidate = donnees[t].meilleure;
+        if (!candidate) continue;
+        if (!meilleure || candidate->distanceTotale < meilleure->distanceTotale
+            || (candidate->distanceTotale == meilleure->distanceTotale
+                && donnees[t].run_meilleure < run_meilleure)) {
+            liberer_tournee(meilleure);
+            meilleure = candidate;
+            run_meilleure = donnees[t].run_meilleure;
+        } else {
+            liberer_tournee(candidate);
+        }
+    }
+
+    if (resume) {
+        // Runs exécutés seulement (l'échéance peut en avoir écarté)
+        resume->nb_runs = 0;
+        resume->nb_threads = nb_lances < nb_threads ? nb_lances + 1 : nb_threads;
+        resume->minimum = travail.longueurs[0];
+        resume->maximum = travail.longueurs[0];
+        double somme = 0.0;
+        for (int r = 0; r < nb_runs; r++) {
+            if (travail.longueurs[r] < 0.0) continue;
+            if (travail.longueurs[r] < resume->minimum) resume->minimum = travail.longueurs[r];
+            if (travail.longueurs[r] > resume->maximum) resume->maximum = travail.longueurs[r];
+            somme += travail.longueurs[r];
+            resume->nb_runs++;
+        }
+        resume->moyenne = resume->nb_runs > 0 ? somme / resume->nb_runs : 0.0;
+    }
+
+    pthread_mutex_destroy(&travail.verrou);
+    free(travail.longueurs);
+    free(threads);
+    free(donnees);
+    return meilleure;
+}
@@ -0,0 +1,29 @@
+#ifndef MULTI_DEPART_H
+#define MULTI_DEPART_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "tsp.h"
+
+typedef enum {
+    DEPART_NN,      // Plus proche voisin depuis une ville de départ différente à chaque run
+    DEPART_RW       // Marche aléatoire avec une graine différente à chaque run
+} TypeDepart;
+
+// Résumé des longueurs obtenues sur l'ensemble des runs
+typedef struct {
+    int nb_runs;
+    int nb_threads;
+    double minimum;
+    double moyenne;
+    double maximum;
+} ResumeMultiDepart;
+
+// Lance nb_runs constructions + 2-opt indépendantes sur nb_threads threads
+// et retourne la meilleure tournée (résumé dans 'resume' si non NULL).
+// 'graine' : marches aléatoires de DEPART_RW (0 : graine par défaut)
+Tournee* multi_depart_2opt(const InstanceTSP* instance, FonctionDistance dist_func,
+                           TypeDepart type, bool avecGrille, int nb_runs, int nb_threads,
+                           uint64_t graine, ResumeMultiDepart* resume);
+
+#endif
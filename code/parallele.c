@@ -0,0 +1,9 @@
+#include <unistd.h>
+
+#include "parallele.h"
+
+int nb_threads_effectif(int demande) {
+    if (demande > 0) return demande;
+    long nb_coeurs = sysconf(_SC_NPROCESSORS_ONLN);
+    return nb_coeurs > 0 ? (int)nb_coeurs : 1;
+}
@@ -0,0 +1,8 @@
+#ifndef PARALLELE_H
+#define PARALLELE_H
+
+// Nombre de threads à utiliser : 'demande' s'il est positif,
+// sinon le nombre de cœurs disponibles
+int nb_threads_effectif(int demande);
+
+#endif
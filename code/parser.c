@@ -1,75 +1,429 @@
 #include "parser.h"
+#include "lecteur.h"
 #include "matrice.h" // Pour liberer_matrice_distances
+#include "candidats.h" // Pour liberer_candidats
+#include "tsp_utils.h" // Pour creer_tournee
+#include "instance_binaire.h"
+#include "fichier_tournee.h" // Pour les tournées binaires
+#include <sys/mman.h>
 #include <string.h>
+#include <limits.h>
 
-#define TAILLE_TAMPON 512
+// Vrai si le mot-clé [cle, cle + longueur) est 'mot'
+static bool cle_egale(const char* cle, size_t longueur, const char* mot) {
+    return strlen(mot) == longueur && memcmp(cle, mot, longueur) == 0;
+}
+
+// Copie [debut, fin) dans 'destination' (tronquée à taille - 1 caractères)
+static void copier_valeur(char* destination, size_t taille, const char* debut, const char* fin) {
+    size_t longueur = (size_t)(fin - debut);
+    if (longueur >= taille) longueur = taille - 1;
+    memcpy(destination, debut, longueur);
+    destination[longueur] = '\0';
+}
+
+// Dispositions de EDGE_WEIGHT_SECTION. La matrice étant symétrique, un format
+// par colonnes équivaut au format par lignes du triangle opposé
+// (UPPER_COL = LOWER_ROW, LOWER_DIAG_COL = UPPER_DIAG_ROW, ...)
+typedef enum {
+    POIDS_INCONNU,
+    POIDS_FULL_MATRIX,
+    POIDS_UPPER_ROW,
+    POIDS_LOWER_ROW,
+    POIDS_UPPER_DIAG_ROW,
+    POIDS_LOWER_DIAG_ROW
+} FormatPoids;
+
+static FormatPoids format_poids(const char* valeur, size_t longueur) {
+    if (cle_egale(valeur, longueur, "FULL_MATRIX")) return POIDS_FULL_MATRIX;
+    if (cle_egale(valeur, longueur, "UPPER_ROW") || cle_egale(valeur, longueur, "LOWER_COL")) {
+        return POIDS_UPPER_ROW;
+    }
+    if (cle_egale(valeur, longueur, "LOWER_ROW") || cle_egale(valeur, longueur, "UPPER_COL")) {
+        return POIDS_LOWER_ROW;
+    }
+    if (cle_egale(valeur, longueur, "UPPER_DIAG_ROW") || cle_egale(valeur, longueur, "LOWER_DIAG_COL")) {
+        return POIDS_UPPER_DIAG_ROW;
+    }
+    if (cle_egale(valeur, longueur, "LOWER_DIAG_ROW") || cle_egale(valeur, longueur, "UPPER_DIAG_COL")) {
+        return POIDS_LOWER_DIAG_ROW;
+    }
+    return POIDS_INCONNU;
+}
 
-// Fonction utilitaire pour supprimer les espaces + les retours à la ligne en fin de chaîne
-static void supprimer_espaces_fin(char* chaine) {
-    int longueur = strlen(chaine);
-    while (longueur > 0 && (chaine[longueur - 1] == '\n' || chaine[longueur - 1] == '\r' || chaine[longueur - 1] == ' ')) {
-        chaine[--longueur] = '\0';
+// Colonnes [*premiere, *derniere] de la ligne r dans le fichier (vide si premiere > derniere)
+static void colonnes_poids(FormatPoids format, int n, int r, int* premiere, int* derniere) {
+    switch (format) {
+    case POIDS_UPPER_ROW:       *premiere = r + 1; *derniere = n - 1; break;
+    case POIDS_UPPER_DIAG_ROW:  *premiere = r;     *derniere = n - 1; break;
+    case POIDS_LOWER_ROW:       *premiere = 0;     *derniere = r - 1; break;
+    case POIDS_LOWER_DIAG_ROW:  *premiere = 0;     *derniere = r;     break;
+    default:                    *premiere = 0;     *derniere = n - 1; break;
     }
 }
 
+/**
+ * Section EDGE_WEIGHT_SECTION, en une passe : chaque poids est rangé directement
+ * dans la matrice triangulaire (matrice.c) à la case de la paire (r, c) que lui
+ * donne le format ; les nombres peuvent être répartis librement sur les lignes.
+ * La diagonale est ignorée ; pour FULL_MATRIX, le triangle inférieur l'emporte.
+ */
+static bool lire_poids(Lecteur* lecteur, InstanceTSP* instance, FormatPoids format) {
+    int n = instance->dimension;
+    double** matrice = instance->matrice_distances;
+    int r = 0, c, derniere;
+    colonnes_poids(format, n, r, &c, &derniere);
+    while (r < n && c > derniere) {
+        r++;
+        colonnes_poids(format, n, r, &c, &derniere);
+    }
+
+    const char* ligne;
+    const char* fin;
+    while (r < n && lecteur_ligne(lecteur, &ligne, &fin)) {
+        const char* p = sauter_espaces(ligne, fin);
+        while (p < fin && r < n) {
+            double poids;
+            p = analyser_reel(p, fin, &poids);
+            if (!p) {
+                fprintf(stderr, "Erreur: ligne %ld : EDGE_WEIGHT_SECTION incomplète ou invalide.\n",
+                        lecteur->ligne);
+                return false;
+            }
+            if (r > c) matrice[r][c] = poids;
+            else if (r < c) matrice[c][r] = poids;
+
+            if (++c > derniere) {
+                do {
+                    r++;
+                    if (r < n) colonnes_poids(format, n, r, &c, &derniere);
+                } while (r < n && c > derniere);
+            }
+            p = sauter_espaces(p, fin);
+        }
+    }
+    if (r < n) {
+        fprintf(stderr, "Erreur: EDGE_WEIGHT_SECTION incomplète.\n");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Section NODE_COORD_SECTION : une ville "numero x y" par ligne, jusqu'à la
+ * première ligne qui ne commence pas par un nombre (EOF ou section suivante),
+ * rendue au lecteur. Faux (message sur stderr) si une ligne est invalide ou
+ * s'il y a plus de villes que DIMENSION.
+ */
+static bool lire_coordonnees(Lecteur* lecteur, InstanceTSP* instance, int* nb_villes) {
+    Ville* villes = instance->villes;
+    int n = *nb_villes;
+    const char* ligne;
+    const char* fin;
+
+    while (lecteur_ligne(lecteur, &ligne, &fin)) {
+        const char* p = sauter_espaces(ligne, fin);
+        if (p == fin) continue;
+        if (*p != '-' && *p != '+' && (*p < '0' || *p > '9')) {
+            lecteur->pos = ligne;
+            lecteur->ligne--;
+            break;
+        }
+
+        long long numero;
+        double x, y;
+        p = analyser_entier(p, fin, &numero);
+        if (p) p = analyser_reel(sauter_espaces(p, fin), fin, &x);
+        if (p) p = analyser_reel(sauter_espaces(p, fin), fin, &y);
+        if (!p) {
+            fprintf(stderr, "Erreur: ligne %ld : coordonnées invalides.\n", lecteur->ligne);
+            return false;
+        }
+        if (n >= instance->dimension) {
+            fprintf(stderr, "Erreur: ligne %ld : plus de villes que DIMENSION (%d).\n",
+                    lecteur->ligne, instance->dimension);
+            return false;
+        }
+        villes[n].numero = (int)numero;
+        villes[n].x = x;
+        villes[n].y = y;
+        n++;
+    }
+    *nb_villes = n;
+    return true;
+}
+
 InstanceTSP* lire_fichier_tsplib(const char* nomFichier) {
-    FILE* fichier = fopen(nomFichier, "r");
-    if (!fichier) {
-        perror("Erreur ouverture du fichier");
+    // Instance binaire écrite par --save-bin : projetée telle quelle
+    if (est_instance_binaire(nomFichier)) {
+        return charger_instance_binaire(nomFichier);
+    }
+
+    Lecteur* lecteur = ouvrir_lecteur(nomFichier);
+    if (!lecteur) {
         return NULL;
     }
 
     InstanceTSP* instance = (InstanceTSP*)calloc(1, sizeof(InstanceTSP));
     instance->matrice_existe = false;
 
-    char tampon[TAILLE_TAMPON];
-    bool dans_section_coords = false;
-    int indice_ville = 0;
-
-    while (fgets(tampon, TAILLE_TAMPON, fichier)) {
-        supprimer_espaces_fin(tampon);
-
-        if (strstr(tampon, "NAME")) {
-            sscanf(tampon, "NAME : %255s", instance->nom);
-        } else if (strstr(tampon, "COMMENT")) {
-            // Gérer les commentaires (si besoin)
-        } else if (strstr(tampon, "TYPE : TSP")) {
-            // Pour le projet en traite que le type TSP
-        } else if (strstr(tampon, "DIMENSION")) {
-            sscanf(tampon, "DIMENSION : %d", &instance->dimension);
-        } else if (strstr(tampon, "EDGE_WEIGHT_TYPE")) {
-            if (strstr(tampon, "EUC_2D")) instance->type_distance = DIST_EUCL_2D;
-            else if (strstr(tampon, "GEO")) instance->type_distance = DIST_GEO;
-            else if (strstr(tampon, "ATT")) instance->type_distance = DIST_ATT;
-        } else if (strstr(tampon, "NODE_COORD_SECTION")) {
-            instance->villes = (Ville*)malloc(instance->dimension * sizeof(Ville));
-            dans_section_coords = true;
-        } else if (strstr(tampon, "EOF")) {
-            break;
-        } else if (dans_section_coords) {
-            int num;
-            double x, y;
-            if (sscanf(tampon, "%d %lf %lf", &num, &x, &y) == 3) {
-                instance->villes[indice_ville].numero = num;
-                instance->villes[indice_ville].x = x;
-                instance->villes[indice_ville].y = y;
-                indice_ville++;
+    int nb_villes = 0;
+    FormatPoids format = POIDS_INCONNU;
+    bool ok = true;
+    const char* ligne;
+    const char* fin;
+
+    while (ok && lecteur_ligne(lecteur, &ligne, &fin)) {
+        const char* cle = sauter_espaces(ligne, fin);
+        if (cle == fin) continue;
+
+        // Ligne "MOT_CLE : valeur" (les deux-points sont facultatifs)
+        const char* fin_cle = cle;
+        while (fin_cle < fin && *fin_cle != ':' && *fin_cle != ' ' && *fin_cle != '\t') fin_cle++;
+        const char* valeur = sauter_espaces(fin_cle, fin);
+        if (valeur < fin && *valeur == ':') valeur = sauter_espaces(valeur + 1, fin);
+        while (fin > valeur && (fin[-1] == ' ' || fin[-1] == '\t')) fin--;
+        size_t longueur_cle = (size_t)(fin_cle - cle);
+
+        if (cle_egale(cle, longueur_cle, "NAME")) {
+            const char* fin_nom = valeur;
+            while (fin_nom < fin && *fin_nom != ' ' && *fin_nom != '\t') fin_nom++;
+            copier_valeur(instance->nom, NOM_MAX, valeur, fin_nom);
+        } else if (cle_egale(cle, longueur_cle, "COMMENT")) {
+            copier_valeur(instance->commentaire, COMMENTAIRE_MAX, valeur, fin);
+        } else if (cle_egale(cle, longueur_cle, "DIMENSION")) {
+            long long dimension;
+            const char* suite = analyser_entier(valeur, fin, &dimension);
+            if (!suite || suite != fin || dimension <= 0 || dimension > INT_MAX / 2) {
+                fprintf(stderr, "Erreur: ligne %ld : DIMENSION invalide.\n", lecteur->ligne);
+                ok = false;
+            } else if (instance->dimension > 0 || instance->villes || instance->matrice_existe) {
+                // Les sections déjà lues sont dimensionnées par la première DIMENSION
+                fprintf(stderr, "Erreur: ligne %ld : DIMENSION en double.\n", lecteur->ligne);
+                ok = false;
+            } else {
+                instance->dimension = (int)dimension;
+            }
+        } else if (cle_egale(cle, longueur_cle, "EDGE_WEIGHT_TYPE")) {
+            size_t longueur = (size_t)(fin - valeur);
+            if (cle_egale(valeur, longueur, "EUC_2D")) instance->type_distance = DIST_EUCL_2D;
+            else if (cle_egale(valeur, longueur, "GEO")) instance->type_distance = DIST_GEO;
+            else if (cle_egale(valeur, longueur, "ATT")) instance->type_distance = DIST_ATT;
+            else if (cle_egale(valeur, longueur, "EXPLICIT")) instance->type_distance = DIST_EXPLICIT;
+            else {
+                fprintf(stderr, "Avertissement: EDGE_WEIGHT_TYPE %.*s non supporté, "
+                        "distance euclidienne utilisée.\n", (int)longueur, valeur);
+                instance->type_distance = DIST_EUCL_2D;
+            }
+        } else if (cle_egale(cle, longueur_cle, "EDGE_WEIGHT_FORMAT")) {
+            // FUNCTION : distances calculées à partir des coordonnées (EDGE_WEIGHT_TYPE)
+            if (cle_egale(valeur, (size_t)(fin - valeur), "FUNCTION")) continue;
+            format = format_poids(valeur, (size_t)(fin - valeur));
+            if (format == POIDS_INCONNU) {
+                fprintf(stderr, "Erreur: EDGE_WEIGHT_FORMAT %.*s non supporté.\n", (int)(fin - valeur), valeur);
+                ok = false;
             }
+        } else if (cle_egale(cle, longueur_cle, "EDGE_WEIGHT_SECTION")) {
+            if (instance->type_distance != DIST_EXPLICIT || instance->dimension <= 0
+                || format == POIDS_INCONNU) {
+                fprintf(stderr, "Erreur: EDGE_WEIGHT_SECTION sans EDGE_WEIGHT_TYPE EXPLICIT, "
+                        "DIMENSION ou EDGE_WEIGHT_FORMAT.\n");
+                ok = false;
+            } else if (instance->matrice_existe) {
+                fprintf(stderr, "Erreur: ligne %ld : EDGE_WEIGHT_SECTION en double.\n", lecteur->ligne);
+                ok = false;
+            } else {
+                ok = allouer_matrice_distances(instance) && lire_poids(lecteur, instance, format);
+            }
+        } else if (cle_egale(cle, longueur_cle, "NODE_COORD_SECTION")) {
+            if (instance->dimension <= 0) {
+                fprintf(stderr, "Erreur: NODE_COORD_SECTION sans DIMENSION.\n");
+                ok = false;
+            } else if (instance->villes) {
+                fprintf(stderr, "Erreur: ligne %ld : NODE_COORD_SECTION en double.\n", lecteur->ligne);
+                ok = false;
+            } else {
+                instance->villes = (Ville*)malloc(instance->dimension * sizeof(Ville));
+                ok = instance->villes && lire_coordonnees(lecteur, instance, &nb_villes);
+            }
+        } else if (cle_egale(cle, longueur_cle, "EOF")) {
+            break;
         }
+        // TYPE et autres mots-clés ignorés (le projet ne traite que le type TSP),
+        // de même que les lignes des sections non lues
     }
+    if (lecteur->erreur) ok = false;
+    fermer_lecteur(lecteur);
 
-    fclose(fichier);    
+    if (ok && instance->type_distance == DIST_EXPLICIT) {
+        if (!instance->matrice_existe) {
+            fprintf(stderr, "Erreur: %s : aucune section EDGE_WEIGHT_SECTION.\n", nomFichier);
+            ok = false;
+        } else if (!instance->villes) {
+            // Sans coordonnées : les villes ne portent que leur numéro
+            instance->villes = (Ville*)calloc(instance->dimension, sizeof(Ville));
+            ok = instance->villes != NULL;
+            for (int i = 0; ok && i < instance->dimension; i++) {
+                instance->villes[i].numero = i + 1;
+            }
+            nb_villes = instance->dimension;
+        }
+    }
+    if (ok && !instance->villes) {
+        fprintf(stderr, "Erreur: %s : aucune section NODE_COORD_SECTION.\n", nomFichier);
+        ok = false;
+    } else if (ok && nb_villes != instance->dimension) {
+        fprintf(stderr, "Erreur: %s : %d villes lues, DIMENSION annonce %d.\n",
+                nomFichier, nb_villes, instance->dimension);
+        ok = false;
+    }
+    if (!ok) {
+        liberer_instance(instance);
+        return NULL;
+    }
     return instance;
 }
 
+/**
+ * Fichier .tour (TOUR_SECTION) : numéros de villes, plusieurs par ligne possible,
+ * terminés par -1 ou EOF. Les numéros sont ceux du fichier .tsp (champ numero),
+ * ramenés aux indices de l'instance, éventuellement renumérotée (-H).
+ */
+Tournee* lire_fichier_tour(const char* nomFichier, const InstanceTSP* instance) {
+    int n = instance->dimension;
+    int* indice_de_numero = (int*)calloc(n + 1, sizeof(int));
+    bool* vue = (bool*)calloc(n + 1, sizeof(bool));
+    Tournee* tournee = creer_tournee(n);
+    bool binaire = est_tournee_binaire(nomFichier);
+    Lecteur* lecteur = (indice_de_numero && vue && tournee && !binaire) ? ouvrir_lecteur(nomFichier) : NULL;
+    bool ok = indice_de_numero && vue && tournee && (binaire || lecteur != NULL);
+
+    for (int i = 0; ok && i < n; i++) {
+        int numero = instance->villes[i].numero;
+        if (numero < 1 || numero > n || indice_de_numero[numero]) {
+            fprintf(stderr, "Erreur: %s : villes de l'instance non numérotées de 1 à %d.\n", nomFichier, n);
+            ok = false;
+        } else {
+            indice_de_numero[numero] = i + 1;
+        }
+    }
+
+    int nb_villes = 0;
+    if (ok && binaire) {
+        // Tournée écrite par --tour-bin : mêmes contrôles que pour TOUR_SECTION
+        int taille;
+        int* numeros = lire_tournee_binaire(nomFichier, &taille);
+        if (!numeros) {
+            ok = false;
+        } else if (taille != n) {
+            fprintf(stderr, "Erreur: %s : DIMENSION différente de celle de l'instance (%d).\n",
+                    nomFichier, n);
+            ok = false;
+        }
+        for (int i = 0; ok && i < n; i++) {
+            int numero = numeros[i];
+            if (numero < 1 || numero > n || vue[numero]) {
+                fprintf(stderr, "Erreur: %s : position %d : ville %d invalide ou répétée.\n",
+                        nomFichier, i + 1, numero);
+                ok = false;
+                break;
+            }
+            vue[numero] = true;
+            tournee->chemin[nb_villes++] = indice_de_numero[numero];
+        }
+        free(numeros);
+    }
+
+    bool dans_section = false;
+    bool termine = false;
+    const char* ligne;
+    const char* fin;
+    while (ok && !binaire && !termine && lecteur_ligne(lecteur, &ligne, &fin)) {
+        const char* p = sauter_espaces(ligne, fin);
+        if (p == fin) continue;
+
+        if (!dans_section) {
+            const char* fin_cle = p;
+            while (fin_cle < fin && *fin_cle != ':' && *fin_cle != ' ' && *fin_cle != '\t') fin_cle++;
+            size_t longueur_cle = (size_t)(fin_cle - p);
+            if (cle_egale(p, longueur_cle, "DIMENSION")) {
+                const char* valeur = sauter_espaces(fin_cle, fin);
+                if (valeur < fin && *valeur == ':') valeur = sauter_espaces(valeur + 1, fin);
+                long long dimension;
+                if (!analyser_entier(valeur, fin, &dimension) || dimension != n) {
+                    fprintf(stderr, "Erreur: %s : DIMENSION différente de celle de l'instance (%d).\n",
+                            nomFichier, n);
+                    ok = false;
+                }
+            } else if (cle_egale(p, longueur_cle, "TOUR_SECTION")) {
+                dans_section = true;
+            } else if (cle_egale(p, longueur_cle, "EOF")) {
+                termine = true;
+            }
+            continue;
+        }
+
+        while (ok && p < fin) {
+            long long numero;
+            p = analyser_entier(p, fin, &numero);
+            if (!p) {
+                // EOF sans -1
+                termine = true;
+                break;
+            }
+            if (numero == -1) {
+                termine = true;
+                break;
+            }
+            if (numero < 1 || numero > n || vue[numero] || nb_villes >= n) {
+                fprintf(stderr, "Erreur: %s : ligne %ld : ville %lld invalide ou répétée.\n",
+                        nomFichier, lecteur->ligne, numero);
+                ok = false;
+                break;
+            }
+            vue[numero] = true;
+            tournee->chemin[nb_villes++] = indice_de_numero[numero];
+            p = sauter_espaces(p, fin);
+        }
+    }
+    if (lecteur && lecteur->erreur) ok = false;
+    if (ok && nb_villes != n) {
+        fprintf(stderr, "Erreur: %s : %d villes dans la tournée, %d attendues.\n", nomFichier, nb_villes, n);
+        ok = false;
+    }
+
+    fermer_lecteur(lecteur);
+    free(indice_de_numero);
+    free(vue);
+    if (!ok) {
+        liberer_tournee(tournee);
+        return NULL;
+    }
+    return tournee;
+}
+
+void retirer_candidats_instance(InstanceTSP* instance) {
+    ListesCandidats* candidats = instance->candidats;
+    if (candidats && instance_binaire_contient(instance, candidats->voisins)) {
+        free(candidats);
+    } else {
+        liberer_candidats(candidats);
+    }
+    instance->candidats = NULL;
+}
+
 void liberer_instance(InstanceTSP* instance) {
     if (instance) {
-        if (instance->villes) {
+        if (instance->villes && !instance_binaire_contient(instance, instance->villes)) {
             free(instance->villes);
         }
         if (instance->matrice_existe) {
             liberer_matrice_distances(instance);
         }
+        retirer_candidats_instance(instance);
+        if (instance->projection) {
+            munmap(instance->projection, instance->taille_projection);
+        }
         free(instance);
     }
 }
\ No newline at end of file
@@ -3,9 +3,17 @@
 
 #include "tsp.h"
 
-// Lit un fichier TSPLIB et retourne une instance TSP remplie
+// Lit un fichier TSPLIB (texte ou compressé par gzip) et retourne une instance TSP remplie ;
+// une instance binaire (--save-bin) est projetée avec sa matrice et ses candidats
 InstanceTSP* lire_fichier_tsplib(const char* nomFichier);
 
+// Lit une tournée TSPLIB (.tour, .opt.tour, éventuellement .gz) de l'instance ;
+// NULL si le fichier n'est pas une permutation des villes de l'instance
+Tournee* lire_fichier_tour(const char* nomFichier, const InstanceTSP* instance);
+
+// Libère les candidats portés par l'instance (éventuellement projetés) ; candidats = NULL
+void retirer_candidats_instance(InstanceTSP* instance);
+
 // Libère la mémoire associée à une instance TSP
 void liberer_instance(InstanceTSP* instance);
 
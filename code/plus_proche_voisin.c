@@ -16,9 +16,15 @@
 #include "tsp_utils.h"
 #include "distance.h"
 #include "matrice.h"
+#include "grille.h"
 
 
 Tournee* plus_proche_voisin(const InstanceTSP* instance, FonctionDistance dist_func) {
+    return plus_proche_voisin_depuis(instance, dist_func, 0);
+}
+
+// Plus proche voisin à partir de la ville 'depart' (0-indexée)
+Tournee* plus_proche_voisin_depuis(const InstanceTSP* instance, FonctionDistance dist_func, int depart) {
     int n = instance->dimension;
     Tournee* tournee = creer_tournee(n);
     if (!tournee) return NULL;
@@ -30,10 +36,9 @@ Tournee* plus_proche_voisin(const InstanceTSP* instance, FonctionDistance dist_f
         return NULL;
     }
     
-    // Commencer par la ville 1
-    int ville_courante = 0;
-    tournee->chemin[0] = 1;  
-    visite[0] = true;
+    int ville_courante = depart;
+    tournee->chemin[0] = depart + 1;
+    visite[depart] = true;
     
     // Pour chaque position dans la tournée
     for (int pos = 1; pos < n; pos++) {
@@ -70,4 +75,50 @@ Tournee* plus_proche_voisin(const InstanceTSP* instance, FonctionDistance dist_f
     
     free(visite);
     return tournee;
+}
+
+/**
+ * Variante du plus proche voisin utilisant une grille uniforme :
+ * la ville non visitée la plus proche est cherchée dans les cellules voisines
+ * au lieu de parcourir les n villes. Même tournée que plus_proche_voisin
+ * lorsque les distances sont distinctes.
+ */
+Tournee* plus_proche_voisin_grille(const InstanceTSP* instance, FonctionDistance dist_func) {
+    return plus_proche_voisin_grille_depuis(instance, dist_func, 0);
+}
+
+Tournee* plus_proche_voisin_grille_depuis(const InstanceTSP* instance, FonctionDistance dist_func,
+                                          int depart) {
+    // La grille suppose une distance croissante avec la distance euclidienne
+    if (!distance_planaire(instance->type_distance)) {
+        return plus_proche_voisin_depuis(instance, dist_func, depart);
+    }
+
+    int n = instance->dimension;
+    Tournee* tournee = creer_tournee(n);
+    if (!tournee) return NULL;
+
+    GrilleVilles* grille = creer_grille(instance, 2);
+    if (!grille) {
+        liberer_tournee(tournee);
+        return NULL;
+    }
+
+    int ville_courante = depart;
+    tournee->chemin[0] = depart + 1;
+    grille_retirer_ville(grille, depart);
+
+    for (int pos = 1; pos < n; pos++) {
+        int ville_proche = grille_plus_proche(grille, instance, dist_func, ville_courante);
+        if (ville_proche == -1) break;
+
+        tournee->chemin[pos] = ville_proche + 1;
+        grille_retirer_ville(grille, ville_proche);
+        ville_courante = ville_proche;
+    }
+
+    calculer_longueur_tournee(tournee, instance, dist_func);
+
+    liberer_grille(grille);
+    return tournee;
 }
\ No newline at end of file
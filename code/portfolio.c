@@ -0,0 +1,281 @@
+/**
+ * portfolio.c
+ * Course de plusieurs solveurs en parallèle, meilleure tournée partagée sans verrou
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <pthread.h>
+
+#include "portfolio.h"
+#include "heuristiques.h"
+#include "tsp_utils.h"
+#include "recuit.h"
+#include "ils.h"
+#include "chrono.h"
+
+#define GRAINE_PORTFOLIO 2025
+
+// Probabilité initiale d'accepter une dégradation quand le recuit repart de la
+// meilleure tournée : une température plus faible préserve sa structure
+#define PROBABILITE_INITIALE_REPRISE 0.05
+
+/**
+ * Meilleure tournée partagée (seqlock) : un écrivain rend 'sequence' impaire
+ * par compare-and-swap, écrit, puis la rend paire ; un lecteur recommence sa
+ * copie si 'sequence' a changé pendant la lecture. Les lecteurs ne bloquent
+ * jamais les écrivains, et les publications (nouvelle meilleure) sont rares.
+ */
+typedef struct {
+    int n;
+    int* chemin;            // Accès atomiques relâchés, élément par élément
+    double longueur;        // DBL_MAX tant que rien n'a été publié
+    int solveur;
+    unsigned sequence;      // Impaire pendant une écriture
+} TourneePartagee;
+
+// Données partagées par les threads
+typedef struct {
+    const InstanceTSP* instance;
+    FonctionDistance dist_func;
+    const ParamsPortfolio* params;
+    double echeance;
+    TourneePartagee meilleure;
+} TravailPortfolio;
+
+// Données propres à chaque thread
+typedef struct {
+    TravailPortfolio* travail;
+    int indice;
+    int ameliorations;
+} ThreadPortfolio;
+
+static const char* const NOMS_SOLVEURS[PORTFOLIO_NB_SOLVEURS] = { "2optnn", "ga", "ils", "sa" };
+
+const char* nom_solveur_portfolio(SolveurPortfolio solveur) {
+    return NOMS_SOLVEURS[solveur];
+}
+
+void params_portfolio_defaut(ParamsPortfolio* params) {
+    params->duree = PORTFOLIO_DUREE_DEFAUT;
+    params->nb_threads = PORTFOLIO_NB_SOLVEURS;
+    params->avec_grille = false;
+    params->ga.taille_population = 30;
+    params->ga.nombre_generations = 1000;
+    params->ga.taux_mutation = 0.1;
+    params->ga.nb_croisements = 15;
+    params->ga.graine = GRAINE_PORTFOLIO;
+    params->ga.checkpoint = NULL;
+    params->ga.tournee_initiale = NULL;
+    params->graine = GRAINE_PORTFOLIO;
+}
+
+static double lire_longueur(TourneePartagee* partage) {
+    double longueur;
+    __atomic_load(&partage->longueur, &longueur, __ATOMIC_RELAXED);
+    return longueur;
+}
+
+// Publie 'tournee' si elle est plus courte que la meilleure ; vrai si elle l'a remplacée
+static bool publier(TourneePartagee* partage, const Tournee* tournee, int solveur) {
+    while (1) {
+        if (tournee->distanceTotale >= lire_longueur(partage) - 1e-9) return false;
+        unsigned sequence = __atomic_load_n(&partage->sequence, __ATOMIC_RELAXED);
+        if (sequence & 1u) continue;    // Autre écrivain en cours
+        if (!__atomic_compare_exchange_n(&partage->sequence, &sequence, sequence + 1, false,
+                                         __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            continue;
+        }
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+
+        // Une tournée encore meilleure a pu être publiée depuis la comparaison
+        bool remplace = tournee->distanceTotale < lire_longueur(partage) - 1e-9;
+        if (remplace) {
+            for (int i = 0; i < partage->n; i++) {
+                __atomic_store_n(&partage->chemin[i], tournee->chemin[i], __ATOMIC_RELAXED);
+            }
+            __atomic_store(&partage->longueur, &tournee->distanceTotale, __ATOMIC_RELAXED);
+            __atomic_store_n(&partage->solveur, solveur, __ATOMIC_RELAXED);
+        }
+        __atomic_store_n(&partage->sequence, sequence + 2, __ATOMIC_RELEASE);
+        return remplace;
+    }
+}
+
+// Copie la meilleure tournée dans 'tournee' ; faux si rien n'a encore été publié
+static bool lire_meilleure(TourneePartagee* partage, Tournee* tournee, int* solveur) {
+    while (1) {
+        unsigned sequence = __atomic_load_n(&partage->sequence, __ATOMIC_ACQUIRE);
+        if (sequence & 1u) continue;
+        double longueur = lire_longueur(partage);
+        if (longueur == DBL_MAX) return false;
+        for (int i = 0; i < partage->n; i++) {
+            tournee->chemin[i] = __atomic_load_n(&partage->chemin[i], __ATOMIC_RELAXED);
+        }
+        int auteur = __atomic_load_n(&partage->solveur, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&partage->sequence, __ATOMIC_RELAXED) == sequence) {
+            tournee->distanceTotale = longueur;
+            if (solveur) *solveur = auteur;
+            return true;
+        }
+    }
+}
+
+static Tournee* construire_nn(const TravailPortfolio* travail, int depart) {
+    return travail->params->avec_grille
+         ? plus_proche_voisin_grille_depuis(travail->instance, travail->dist_func, depart)
+         : plus_proche_voisin_depuis(travail->instance, travail->dist_func, depart);
+}
+
+// Tour 'tour' du solveur ; NULL en cas d'échec d'allocation
+static Tournee* executer_solveur(TravailPortfolio* travail, SolveurPortfolio solveur,
+                                 int indice, int tour, uint64_t graine) {
+    const InstanceTSP* instance = travail->instance;
+    FonctionDistance dist_func = travail->dist_func;
+    int n = instance->dimension;
+    Tournee* tournee = NULL;
+
+    switch (solveur) {
+    case SOLVEUR_2OPTNN: {
+        // Villes de départ différentes d'un thread et d'un tour à l'autre
+        int depart = (int)(((long long)tour * travail->params->nb_threads + indice) % n);
+        tournee = construire_nn(travail, depart);
+        if (tournee) deux_opt(tournee, instance, dist_func);
+        break;
+    }
+    case SOLVEUR_GA: {
+        ParamsGA params = travail->params->ga;
+        params.graine = graine;
+        tournee = algorithme_genetique(instance, dist_func, &params, croisement_ordonne);
+        if (tournee) {
+            calculer_longueur_tournee(tournee, instance, dist_func);
+            deux_opt(tournee, instance, dist_func);
+        }
+        break;
+    }
+    case SOLVEUR_ILS:
+    case SOLVEUR_SA: {
+        tournee = creer_tournee(n);
+        if (!tournee) break;
+        bool reprise = lire_meilleure(&travail->meilleure, tournee, NULL);
+        if (!reprise) {
+            liberer_tournee(tournee);
+            tournee = construire_nn(travail, 0);
+            if (!tournee) break;
+        }
+        if (solveur == SOLVEUR_ILS) {
+            ParamsILS params;
+            params_ils_defaut(&params);
+            params.graine = graine;
+            recherche_locale_iteree(tournee, instance, dist_func, &params);
+        } else {
+            ParamsRecuit params;
+            params_recuit_defaut(&params);
+            params.graine = graine;
+            if (reprise) params.probabilite_initiale = PROBABILITE_INITIALE_REPRISE;
+            recuit_simule(tournee, instance, dist_func, &params);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    return tournee;
+}
+
+static void* thread_portfolio(void* arg) {
+    ThreadPortfolio* donnees = (ThreadPortfolio*)arg;
+    TravailPortfolio* travail = donnees->travail;
+    SolveurPortfolio solveur = (SolveurPortfolio)(donnees->indice % PORTFOLIO_NB_SOLVEURS);
+
+    // L'échéance est propre à chaque thread (chrono.h)
+    echeance_definir(travail->echeance);
+    for (int tour = 0; !echeance_atteinte(); tour++) {
+        // Graine propre à chaque thread et à chaque tour
+        uint64_t graine = travail->params->graine + 1000003ULL * (uint64_t)donnees->indice
+                        + (uint64_t)tour;
+        Tournee* tournee = executer_solveur(travail, solveur, donnees->indice, tour, graine);
+        if (!tournee) break;
+        if (publier(&travail->meilleure, tournee, solveur)) {
+            donnees->ameliorations++;
+        }
+        liberer_tournee(tournee);
+    }
+    return NULL;
+}
+
+Tournee* portfolio(const InstanceTSP* instance, FonctionDistance dist_func,
+                   const ParamsPortfolio* params, ResumePortfolio* resume) {
+    int n = instance->dimension;
+    int nb_threads = params->nb_threads > PORTFOLIO_NB_SOLVEURS ? params->nb_threads
+                                                                : PORTFOLIO_NB_SOLVEURS;
+    ParamsPortfolio params_threads = *params;
+    params_threads.nb_threads = nb_threads;
+
+    // Échéance du portfolio, sans dépasser celle du thread appelant
+    double echeance_appelant = echeance_obtenir();
+    double echeance = temps_mur() + (params->duree > 0.0 ? params->duree : PORTFOLIO_DUREE_DEFAUT);
+    if (echeance_appelant > 0.0 && echeance_appelant < echeance) echeance = echeance_appelant;
+
+    TravailPortfolio travail;
+    travail.instance = instance;
+    travail.dist_func = dist_func;
+    travail.params = &params_threads;
+    travail.echeance = echeance;
+    travail.meilleure.n = n;
+    travail.meilleure.chemin = (int*)malloc(n * sizeof(int));
+    travail.meilleure.longueur = DBL_MAX;
+    travail.meilleure.solveur = 0;
+    travail.meilleure.sequence = 0;
+
+    pthread_t* threads = (pthread_t*)malloc(nb_threads * sizeof(pthread_t));
+    ThreadPortfolio* donnees = (ThreadPortfolio*)calloc(nb_threads, sizeof(ThreadPortfolio));
+    Tournee* resultat = creer_tournee(n);
+    if (!travail.meilleure.chemin || !threads || !donnees || !resultat) {
+        free(travail.meilleure.chemin);
+        free(threads);
+        free(donnees);
+        liberer_tournee(resultat);
+        return NULL;
+    }
+
+    for (int t = 0; t < nb_threads; t++) {
+        donnees[t].travail = &travail;
+        donnees[t].indice = t;
+    }
+    // Si un thread ne peut être créé, le portfolio continue avec les solveurs lancés
+    int nb_lances = 1;
+    while (nb_lances < nb_threads
+           && pthread_create(&threads[nb_lances], NULL, thread_portfolio, &donnees[nb_lances]) == 0) {
+        nb_lances++;
+    }
+    thread_portfolio(&donnees[0]);
+    for (int t = 1; t < nb_lances; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    echeance_definir(echeance_appelant);
+
+    int solveur = 0;
+    if (lire_meilleure(&travail.meilleure, resultat, &solveur)) {
+        calculer_longueur_tournee(resultat, instance, dist_func);
+    } else {
+        liberer_tournee(resultat);
+        resultat = NULL;
+    }
+
+    if (resume) {
+        resume->nb_threads = nb_lances;
+        for (int s = 0; s < PORTFOLIO_NB_SOLVEURS; s++) resume->ameliorations[s] = 0;
+        for (int t = 0; t < nb_lances; t++) {
+            resume->ameliorations[t % PORTFOLIO_NB_SOLVEURS] += donnees[t].ameliorations;
+        }
+        resume->solveur_meilleure = (SolveurPortfolio)solveur;
+    }
+
+    free(travail.meilleure.chemin);
+    free(threads);
+    free(donnees);
+    return resultat;
+}
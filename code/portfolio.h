@@ -0,0 +1,48 @@
+#ifndef PORTFOLIO_H
+#define PORTFOLIO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "tsp.h"
+#include "ga_generique.h"
+
+// Budget par défaut (secondes) si aucune durée n'est donnée
+#define PORTFOLIO_DUREE_DEFAUT 10.0
+
+// Solveurs mis en concurrence ; le thread t exécute le solveur t % PORTFOLIO_NB_SOLVEURS
+typedef enum {
+    SOLVEUR_2OPTNN,     // Plus proche voisin depuis une ville différente à chaque tour + 2-opt
+    SOLVEUR_GA,         // Algorithme génétique (croisement ordonné) + 2-opt
+    SOLVEUR_ILS,        // Recherche locale itérée, repart de la meilleure tournée partagée
+    SOLVEUR_SA,         // Recuit simulé, repart de la meilleure tournée partagée
+    PORTFOLIO_NB_SOLVEURS
+} SolveurPortfolio;
+
+typedef struct {
+    double duree;           // Budget en secondes (temps écoulé)
+    int nb_threads;         // Au moins un thread par solveur
+    bool avec_grille;       // Plus proche voisin par grille (2optnn et tournées initiales)
+    ParamsGA ga;
+    uint64_t graine;
+} ParamsPortfolio;
+
+typedef struct {
+    int nb_threads;
+    int ameliorations[PORTFOLIO_NB_SOLVEURS];  // Publications d'une nouvelle meilleure tournée
+    SolveurPortfolio solveur_meilleure;        // Auteur de la tournée retournée
+} ResumePortfolio;
+
+void params_portfolio_defaut(ParamsPortfolio* params);
+
+const char* nom_solveur_portfolio(SolveurPortfolio solveur);
+
+/**
+ * Portfolio : les solveurs tournent en parallèle jusqu'à l'échéance et publient
+ * leurs tournées dans un emplacement partagé sans verrou (seqlock) ; ILS et recuit
+ * repartent à chaque tour de la meilleure tournée publiée. Retourne cette tournée
+ * (résumé dans 'resume' si non NULL).
+ */
+Tournee* portfolio(const InstanceTSP* instance, FonctionDistance dist_func,
+                   const ParamsPortfolio* params, ResumePortfolio* resume);
+
+#endif
@@ -0,0 +1,201 @@
+/**
+ * recherche_locale.c
+ * 2-opt et Or-opt sur listes de candidats avec don't-look bits
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "recherche_locale.h"
+#include "matrice.h"
+#include "chrono.h"
+#include "mesures.h"
+
+#define LONGUEUR_MAX_SEGMENT 3
+#define EPSILON_GAIN 1e-9
+
+RechercheLocale* creer_recherche_locale(const InstanceTSP* instance, FonctionDistance dist_func,
+                                        const ListesCandidats* candidats, TourneeTableau* tableau) {
+    RechercheLocale* recherche = (RechercheLocale*)calloc(1, sizeof(RechercheLocale));
+    if (!recherche) return NULL;
+    recherche->instance = instance;
+    recherche->dist_func = dist_func;
+    recherche->candidats = candidats;
+    recherche->tableau = tableau;
+    recherche->file = (int*)malloc(tableau->n * sizeof(int));
+    recherche->dans_file = (bool*)calloc(tableau->n, sizeof(bool));
+    if (!recherche->file || !recherche->dans_file) {
+        liberer_recherche_locale(recherche);
+        return NULL;
+    }
+    return recherche;
+}
+
+void liberer_recherche_locale(RechercheLocale* recherche) {
+    if (recherche) {
+        free(recherche->file);
+        free(recherche->dans_file);
+        free(recherche);
+    }
+}
+
+void recherche_locale_activer(RechercheLocale* recherche, int v) {
+    if (recherche->dans_file[v]) return;
+    int n = recherche->tableau->n;
+    recherche->file[(recherche->tete + recherche->nb_dans_file) % n] = v;
+    recherche->nb_dans_file++;
+    recherche->dans_file[v] = true;
+}
+
+void recherche_locale_activer_tout(RechercheLocale* recherche) {
+    for (int v = 0; v < recherche->tableau->n; v++) {
+        recherche_locale_activer(recherche, v);
+    }
+}
+
+static int retirer_de_file(RechercheLocale* recherche) {
+    int v = recherche->file[recherche->tete];
+    recherche->tete = (recherche->tete + 1) % recherche->tableau->n;
+    recherche->nb_dans_file--;
+    recherche->dans_file[v] = false;
+    return v;
+}
+
+static double d(const RechercheLocale* recherche, int a, int b) {
+    return distance_villes(recherche->instance, recherche->dist_func, a, b);
+}
+
+// Meilleur 2-opt faisant entrer une arête (a, c) ; retourne vrai s'il a été appliqué
+static bool essayer_2opt(RechercheLocale* recherche, int a, double* gain_total) {
+    const TourneeTableau* t = recherche->tableau;
+    const int* voisins = recherche->candidats->voisins + (size_t)a * recherche->candidats->k;
+    int sa = tableau_suivante(t, a), pa = tableau_precedente(t, a);
+    double d_suiv = d(recherche, a, sa), d_prec = d(recherche, pa, a);
+    double meilleur_gain = EPSILON_GAIN;
+    int meilleur_x = -1, meilleur_y = -1;
+    unsigned long long essais = 0;
+
+    for (int r = 0; r < recherche->candidats->k; r++) {
+        int c = voisins[r];
+        double d_ac = d(recherche, a, c);
+        if (d_ac >= d_suiv && d_ac >= d_prec) {
+            // Listes triées : les candidats suivants sont plus loin
+            if (recherche->candidats->triee_par_distance) break;
+            continue;
+        }
+
+        // Retire (a, suiv a) et (c, suiv c)
+        int sc = tableau_suivante(t, c);
+        if (d_ac < d_suiv && c != sa && sc != a) {
+            double gain = d_suiv + d(recherche, c, sc) - d_ac - d(recherche, sa, sc);
+            essais++;
+            if (gain > meilleur_gain) {
+                meilleur_gain = gain;
+                meilleur_x = a;
+                meilleur_y = c;
+            }
+        }
+        // Retire (préc a, a) et (préc c, c)
+        int pc = tableau_precedente(t, c);
+        if (d_ac < d_prec && c != pa && pc != a) {
+            double gain = d_prec + d(recherche, pc, c) - d_ac - d(recherche, pa, pc);
+            essais++;
+            if (gain > meilleur_gain) {
+                meilleur_gain = gain;
+                meilleur_x = pa;
+                meilleur_y = pc;
+            }
+        }
+    }
+    MESURES_COMPTER(COMPTEUR_2OPT_ESSAIS, essais);
+    if (meilleur_x < 0) return false;
+
+    MESURES_COMPTER(COMPTEUR_2OPT_APPLIQUES, 1);
+    int sx = tableau_suivante(t, meilleur_x), sy = tableau_suivante(t, meilleur_y);
+    tableau_2opt(recherche->tableau, meilleur_x, meilleur_y);
+    recherche_locale_activer(recherche, meilleur_x);
+    recherche_locale_activer(recherche, sx);
+    recherche_locale_activer(recherche, meilleur_y);
+    recherche_locale_activer(recherche, sy);
+    *gain_total += meilleur_gain;
+    return true;
+}
+
+// Meilleur Or-opt plaçant un segment d'extrémité a à côté d'un candidat c
+static bool essayer_oropt(RechercheLocale* recherche, int a, double* gain_total) {
+    const TourneeTableau* t = recherche->tableau;
+    int n = t->n;
+    const int* voisins = recherche->candidats->voisins + (size_t)a * recherche->candidats->k;
+    double meilleur_gain = EPSILON_GAIN;
+    int m_s1 = -1, m_s2 = -1, m_u = -1;
+    bool m_inverse = false;
+
+    for (int longueur = 1; longueur <= LONGUEUR_MAX_SEGMENT && longueur <= n - 4; longueur++) {
+        for (int sens = 0; sens < 2; sens++) {
+            // sens 0 : segment a ... s2 (a en tête) ; sens 1 : s1 ... a (a en queue)
+            int pos_a = t->position[a];
+            int s1 = sens == 0 ? a : t->ordre[(pos_a - longueur + 1 + n) % n];
+            int s2 = sens == 0 ? t->ordre[(pos_a + longueur - 1) % n] : a;
+            int p = tableau_precedente(t, s1), nx = tableau_suivante(t, s2);
+            int exterieur = sens == 0 ? p : nx;
+            double d_exterieur = d(recherche, exterieur, a);
+            double retire = d(recherche, p, s1) + d(recherche, s2, nx) - d(recherche, p, nx);
+
+            for (int r = 0; r < recherche->candidats->k; r++) {
+                int c = voisins[r];
+                double d_ac = d(recherche, a, c);
+                if (d_ac >= d_exterieur) {
+                    if (recherche->candidats->triee_par_distance) break;
+                    continue;
+                }
+                if (tableau_dans_segment(t, c, s1, longueur)) continue;
+
+                // a adjacente à c : insertion entre (c, suiv c) ou (préc c, c)
+                for (int cote = 0; cote < 2; cote++) {
+                    int u = cote == 0 ? c : tableau_precedente(t, c);
+                    int v = tableau_suivante(t, u);
+                    if (u == p || tableau_dans_segment(t, u, s1, longueur)) continue;
+                    // Le sens d'insertion est imposé par l'adjacence de a et c
+                    bool inverse = (sens == 0) != (cote == 0);
+                    double ajoute = inverse ? d(recherche, u, s2) + d(recherche, s1, v)
+                                            : d(recherche, u, s1) + d(recherche, s2, v);
+                    double gain = retire + d(recherche, u, v) - ajoute;
+                    if (gain > meilleur_gain) {
+                        meilleur_gain = gain;
+                        m_s1 = s1;
+                        m_s2 = s2;
+                        m_u = u;
+                        m_inverse = inverse;
+                    }
+                }
+            }
+        }
+    }
+    if (m_s1 < 0) return false;
+
+    int p = tableau_precedente(t, m_s1), nx = tableau_suivante(t, m_s2);
+    int v = tableau_suivante(t, m_u);
+    tableau_oropt(recherche->tableau, m_s1, m_s2, m_u, m_inverse);
+    recherche_locale_activer(recherche, p);
+    recherche_locale_activer(recherche, nx);
+    recherche_locale_activer(recherche, m_s1);
+    recherche_locale_activer(recherche, m_s2);
+    recherche_locale_activer(recherche, m_u);
+    recherche_locale_activer(recherche, v);
+    *gain_total += meilleur_gain;
+    return true;
+}
+
+double recherche_locale_optimiser(RechercheLocale* recherche) {
+    double gain_total = 0.0;
+    long long nb_examens = 0;
+    // Journal de la tournée plein (tournee_tableau.h) : mouvements refusés, arrêt
+    while (recherche->nb_dans_file > 0 && !recherche->tableau->erreur_journal) {
+        if ((++nb_examens & 255) == 0 && echeance_atteinte()) break;
+        int a = retirer_de_file(recherche);
+        if (essayer_2opt(recherche, a, &gain_total) || essayer_oropt(recherche, a, &gain_total)) {
+            recherche_locale_activer(recherche, a);
+        }
+    }
+    return gain_total;
+}
@@ -0,0 +1,38 @@
+#ifndef RECHERCHE_LOCALE_H
+#define RECHERCHE_LOCALE_H
+
+#include <stdbool.h>
+#include "tsp.h"
+#include "candidats.h"
+#include "tournee_tableau.h"
+
+// Recherche locale 2-opt + Or-opt sur listes de candidats, avec don't-look bits :
+// seules les villes de la file (bits remis à zéro) sont réexaminées.
+typedef struct {
+    const InstanceTSP* instance;
+    FonctionDistance dist_func;
+    const ListesCandidats* candidats;
+    TourneeTableau* tableau;
+    int* file;              // File circulaire des villes actives
+    bool* dans_file;        // Don't-look bit à zéro
+    int tete;
+    int nb_dans_file;
+} RechercheLocale;
+
+// La recherche locale travaille sur 'tableau', qui reste la propriété de l'appelant
+RechercheLocale* creer_recherche_locale(const InstanceTSP* instance, FonctionDistance dist_func,
+                                        const ListesCandidats* candidats, TourneeTableau* tableau);
+
+void liberer_recherche_locale(RechercheLocale* recherche);
+
+// Remet à zéro le don't-look bit de la ville v (0-indexée)
+void recherche_locale_activer(RechercheLocale* recherche, int v);
+
+// Active toutes les villes
+void recherche_locale_activer_tout(RechercheLocale* recherche);
+
+// Applique des mouvements améliorants jusqu'à vider la file ou atteindre l'échéance
+// du thread (les villes restantes restent actives) ; retourne le gain total
+double recherche_locale_optimiser(RechercheLocale* recherche);
+
+#endif
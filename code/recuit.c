@@ -0,0 +1,226 @@
+/**
+ * recuit.c
+ * Recuit simulé : mouvements 2-opt, Or-opt et échange évalués en O(1),
+ * température initiale estimée par échantillonnage, redémarrage sur stagnation
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <math.h>
+
+#include "recuit.h"
+#include "tsp_utils.h"
+#include "matrice.h"
+#include "candidats.h"
+#include "alea.h"
+#include "tournee_tableau.h"
+#include "chrono.h"
+
+#define NB_ECHANTILLONS_TEMPERATURE 1000
+#define LONGUEUR_MAX_SEGMENT 3
+
+typedef enum {
+    MOUVEMENT_2OPT,
+    MOUVEMENT_OROPT,
+    MOUVEMENT_ECHANGE
+} TypeMouvement;
+
+// Mouvement proposé et son coût
+typedef struct {
+    TypeMouvement type;
+    int a;              // Ville de référence
+    int c;              // Ville candidate (voisine géographique de a)
+    int fin_segment;    // Or-opt : dernière ville du segment commençant en a
+    bool inverse;       // Or-opt : segment inséré à l'envers
+    double delta;
+} Mouvement;
+
+typedef struct {
+    TourneeTableau* t;
+    const InstanceTSP* instance;
+    FonctionDistance dist_func;
+} EtatRecuit;
+
+static double d(const EtatRecuit* e, int a, int b) {
+    return distance_villes(e->instance, e->dist_func, a, b);
+}
+
+static int suivante(const EtatRecuit* e, int v) {
+    return tableau_suivante(e->t, v);
+}
+
+static int precedente(const EtatRecuit* e, int v) {
+    return tableau_precedente(e->t, v);
+}
+
+static void evaluer_2opt(const EtatRecuit* e, Mouvement* m) {
+    int a = m->a, c = m->c;
+    int b = suivante(e, a), dd = suivante(e, c);
+    if (c == b || dd == a) {
+        m->delta = INFINITY;
+        return;
+    }
+    m->delta = d(e, a, c) + d(e, b, dd) - d(e, a, b) - d(e, c, dd);
+}
+
+// Or-opt : le segment [a, fin_segment] est inséré entre c et suiv(c)
+static void evaluer_oropt(const EtatRecuit* e, Mouvement* m, int longueur) {
+    int a = m->a, c = m->c;
+    int n = e->t->n;
+    if (longueur > n - 3) {
+        m->delta = INFINITY;
+        return;
+    }
+    int fin = e->t->ordre[(e->t->position[a] + longueur - 1) % n];
+    int p = precedente(e, a), nx = suivante(e, fin);
+    int dd = suivante(e, c);
+    if (tableau_dans_segment(e->t, c, a, longueur) || c == p) {
+        m->delta = INFINITY;
+        return;
+    }
+    double retire = d(e, p, a) + d(e, fin, nx) + d(e, c, dd);
+    double direct = d(e, c, a) + d(e, fin, dd);
+    double inverse = d(e, c, fin) + d(e, a, dd);
+    m->fin_segment = fin;
+    m->inverse = inverse < direct;
+    m->delta = d(e, p, nx) + (m->inverse ? inverse : direct) - retire;
+}
+
+// Échange de suiv(a) et c : rend c adjacente à a
+static void evaluer_echange(const EtatRecuit* e, Mouvement* m) {
+    int u = suivante(e, m->a), v = m->c;
+    if (u == v || v == m->a) {
+        m->delta = INFINITY;
+        return;
+    }
+    int pu = precedente(e, u), su = suivante(e, u);
+    int pv = precedente(e, v), sv = suivante(e, v);
+    if (su == v) {
+        m->delta = d(e, pu, v) + d(e, u, sv) - d(e, pu, u) - d(e, v, sv);
+    } else if (sv == u) {
+        m->delta = d(e, pv, u) + d(e, v, su) - d(e, pv, v) - d(e, u, su);
+    } else {
+        m->delta = d(e, pu, v) + d(e, v, su) + d(e, pv, u) + d(e, u, sv)
+                 - d(e, pu, u) - d(e, u, su) - d(e, pv, v) - d(e, v, sv);
+    }
+}
+
+// Tire un mouvement aléatoire guidé par les listes de candidats
+static void tirer_mouvement(const EtatRecuit* e, const ListesCandidats* candidats,
+                            Alea* alea, Mouvement* m) {
+    m->a = alea_entier(alea, e->t->n);
+    m->c = candidats->voisins[(size_t)m->a * candidats->k + alea_entier(alea, candidats->k)];
+    int tirage = alea_entier(alea, 10);
+    if (tirage < 6) {
+        m->type = MOUVEMENT_2OPT;
+        evaluer_2opt(e, m);
+    } else if (tirage < 9) {
+        m->type = MOUVEMENT_OROPT;
+        evaluer_oropt(e, m, 1 + alea_entier(alea, LONGUEUR_MAX_SEGMENT));
+    } else {
+        m->type = MOUVEMENT_ECHANGE;
+        evaluer_echange(e, m);
+    }
+}
+
+static void appliquer_mouvement(EtatRecuit* e, const Mouvement* m) {
+    switch (m->type) {
+        case MOUVEMENT_2OPT:
+            tableau_2opt(e->t, m->a, m->c);
+            break;
+        case MOUVEMENT_OROPT:
+            tableau_oropt(e->t, m->a, m->fin_segment, m->c, m->inverse);
+            break;
+        case MOUVEMENT_ECHANGE:
+            tableau_echange(e->t, suivante(e, m->a), m->c);
+            break;
+    }
+}
+
+void params_recuit_defaut(ParamsRecuit* params) {
+    params->facteur_refroidissement = 0.95;
+    params->mouvements_par_ville = 10;
+    params->probabilite_initiale = 0.5;
+    params->ratio_temperature_finale = 1e-3;
+    params->paliers_stagnation = 10;
+    params->graine = 2025;
+}
+
+void recuit_simule(Tournee* meilleure, const InstanceTSP* instance, FonctionDistance dist_func,
+                   const ParamsRecuit* params) {
+    int n = instance->dimension;
+    if (!meilleure || n < 5) return;
+
+    ListesCandidats* candidats = candidats_recherche_locale(instance, dist_func);
+    EtatRecuit etat;
+    etat.t = creer_tournee_tableau(meilleure);
+    etat.instance = instance;
+    etat.dist_func = dist_func;
+    if (!candidats || !etat.t) {
+        liberer_candidats(candidats);
+        liberer_tournee_tableau(etat.t);
+        return;
+    }
+
+    Alea alea;
+    alea_initialiser(&alea, params->graine);
+    Mouvement m;
+
+    // Température initiale : dégradation moyenne acceptée avec probabilite_initiale
+    double somme_degradations = 0.0;
+    int nb_degradations = 0;
+    for (int s = 0; s < NB_ECHANTILLONS_TEMPERATURE; s++) {
+        tirer_mouvement(&etat, candidats, &alea, &m);
+        if (m.delta > 0.0 && isfinite(m.delta)) {
+            somme_degradations += m.delta;
+            nb_degradations++;
+        }
+    }
+    double t0 = nb_degradations > 0
+              ? -(somme_degradations / nb_degradations) / log(params->probabilite_initiale)
+              : 1.0;
+    double temperature = t0;
+    double t_finale = t0 * params->ratio_temperature_finale;
+    long long mouvements_par_palier = (long long)params->mouvements_par_ville * n;
+
+    double longueur = meilleure->distanceTotale;
+    double meilleure_longueur = longueur;
+    int paliers_sans_progres = 0;
+
+    bool echeance = false;
+    while (temperature > t_finale && !echeance) {
+        bool progres = false;
+        for (long long k = 0; k < mouvements_par_palier; k++) {
+            if ((k & 1023) == 0 && echeance_atteinte()) {
+                echeance = true;
+                break;
+            }
+            tirer_mouvement(&etat, candidats, &alea, &m);
+            if (!isfinite(m.delta)) continue;
+            if (m.delta < 0.0 || alea_reel(&alea) < exp(-m.delta / temperature)) {
+                appliquer_mouvement(&etat, &m);
+                longueur += m.delta;
+                if (longueur < meilleure_longueur - 1e-9) {
+                    meilleure_longueur = longueur;
+                    tableau_vers_tournee(etat.t, meilleure);
+                    progres = true;
+                }
+            }
+        }
+
+        // Stagnation : repartir de la meilleure tournée
+        paliers_sans_progres = progres ? 0 : paliers_sans_progres + 1;
+        if (paliers_sans_progres >= params->paliers_stagnation) {
+            tableau_depuis_tournee(etat.t, meilleure);
+            longueur = meilleure_longueur;
+            paliers_sans_progres = 0;
+        }
+        temperature *= params->facteur_refroidissement;
+    }
+
+    calculer_longueur_tournee(meilleure, instance, dist_func);
+
+    liberer_candidats(candidats);
+    liberer_tournee_tableau(etat.t);
+}
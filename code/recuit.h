@@ -0,0 +1,25 @@
+#ifndef RECUIT_H
+#define RECUIT_H
+
+#include <stdint.h>
+#include "tsp.h"
+
+// Paramètres du recuit simulé
+typedef struct {
+    double facteur_refroidissement;     // T <- T * facteur à chaque palier
+    int mouvements_par_ville;           // Mouvements tentés par palier = mouvements_par_ville * n
+    double probabilite_initiale;        // Probabilité d'accepter une dégradation moyenne au départ
+    double ratio_temperature_finale;    // Arrêt quand T < T0 * ratio
+    int paliers_stagnation;             // Retour à la meilleure tournée après ce nombre de paliers sans progrès
+    uint64_t graine;
+} ParamsRecuit;
+
+// Valeurs par défaut
+void params_recuit_defaut(ParamsRecuit* params);
+
+// Recuit simulé (2-opt, Or-opt, échange) à partir de 'tournee',
+// remplacée par la meilleure tournée rencontrée. S'arrête à l'échéance du thread (chrono.h).
+void recuit_simule(Tournee* tournee, const InstanceTSP* instance, FonctionDistance dist_func,
+                   const ParamsRecuit* params);
+
+#endif
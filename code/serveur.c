@@ -0,0 +1,670 @@
+/**
+ * serveur.c
+ * Mode serveur : travaux JSON par ligne (entrée standard ou socket Unix),
+ * groupe de threads et cache des instances
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include "serveur.h"
+#include "cache_instances.h"
+#include "json.h"
+#include "parser.h"
+#include "tsp_utils.h"
+#include "fichier_tournee.h"
+#include "parallele.h"
+
+// Travaux lus mais pas encore commencés : au-delà, la lecture attend les threads
+#define FILE_TRAVAUX_MAX 1024
+#define CHEMIN_MAX 4096
+#define ID_MAX 256
+
+// Flux de réponses d'un client (sortie standard ou connexion à la socket)
+typedef struct {
+    int fd;
+    bool a_fermer;              // Connexion : fermée quand plus rien ne la référence
+    int references;             // Lecture en cours + travaux sans réponse
+    pthread_mutex_t verrou;     // Une réponse à la fois
+} Connexion;
+
+typedef struct TravailServeur {
+    char* ligne;
+    size_t longueur;
+    Connexion* connexion;
+    struct TravailServeur* suivant;
+} TravailServeur;
+
+typedef struct {
+    TravailServeur* tete;
+    TravailServeur* queue;
+    int nb;
+    bool fermee;                // Plus de dépôt ; les threads finissent la file puis s'arrêtent
+    long long nb_recus;
+    pthread_mutex_t verrou;
+    pthread_cond_t non_vide;
+    pthread_cond_t non_pleine;
+} FileTravaux;
+
+typedef struct LecteurConnexion LecteurConnexion;
+
+typedef struct {
+    const ParamsServeur* params;
+    CacheInstances* cache;
+    FileTravaux file;
+    // Lecteurs des connexions en cours (mode socket) : attendus avant de détruire la file
+    LecteurConnexion* lecteurs;
+    pthread_mutex_t verrou_lecteurs;
+    pthread_cond_t fin_lecteur;
+} Serveur;
+
+// Un travail analysé
+typedef struct {
+    char id[ID_MAX];            // Valeur JSON de "id" recopiée telle quelle ("" si absente)
+    char instance[CHEMIN_MAX];
+    char methode[32];
+    char nom[NOM_MAX];
+    char type[16];
+    Ville* villes;              // "coords" : instance donnée dans le travail
+    int nb_villes;
+    ParamsMethode params;
+    bool avec_tournee;
+} Demande;
+
+static volatile sig_atomic_t arret_serveur = 0;
+
+static void interruption_serveur(int signal) {
+    (void)signal;
+    arret_serveur = 1;
+}
+
+/* ---- Connexions ---- */
+
+static Connexion* creer_connexion(int fd, bool a_fermer) {
+    Connexion* connexion = (Connexion*)malloc(sizeof(Connexion));
+    if (!connexion) return NULL;
+    connexion->fd = fd;
+    connexion->a_fermer = a_fermer;
+    connexion->references = 1;
+    pthread_mutex_init(&connexion->verrou, NULL);
+    return connexion;
+}
+
+static void connexion_prendre(Connexion* connexion) {
+    pthread_mutex_lock(&connexion->verrou);
+    connexion->references++;
+    pthread_mutex_unlock(&connexion->verrou);
+}
+
+static void connexion_relacher(Connexion* connexion) {
+    pthread_mutex_lock(&connexion->verrou);
+    int restantes = --connexion->references;
+    pthread_mutex_unlock(&connexion->verrou);
+    if (restantes == 0) {
+        if (connexion->a_fermer) close(connexion->fd);
+        pthread_mutex_destroy(&connexion->verrou);
+        free(connexion);
+    }
+}
+
+// Réponse complète écrite d'un bloc (un client parti n'interrompt pas le serveur : SIGPIPE ignoré)
+static void connexion_ecrire(Connexion* connexion, const char* texte, size_t taille) {
+    pthread_mutex_lock(&connexion->verrou);
+    while (taille > 0) {
+        ssize_t ecrit = write(connexion->fd, texte, taille);
+        if (ecrit < 0 && errno == EINTR) continue;
+        if (ecrit <= 0) break;
+        texte += ecrit;
+        taille -= (size_t)ecrit;
+    }
+    pthread_mutex_unlock(&connexion->verrou);
+}
+
+/* ---- File des travaux ---- */
+
+static void initialiser_file(FileTravaux* file) {
+    memset(file, 0, sizeof(FileTravaux));
+    pthread_mutex_init(&file->verrou, NULL);
+    pthread_cond_init(&file->non_vide, NULL);
+    pthread_cond_init(&file->non_pleine, NULL);
+}
+
+static void detruire_file(FileTravaux* file) {
+    pthread_cond_destroy(&file->non_pleine);
+    pthread_cond_destroy(&file->non_vide);
+    pthread_mutex_destroy(&file->verrou);
+}
+
+// false si la file est fermée (le travail n'est pas pris)
+static bool deposer_travail(FileTravaux* file, TravailServeur* travail) {
+    pthread_mutex_lock(&file->verrou);
+    while (file->nb >= FILE_TRAVAUX_MAX && !file->fermee) {
+        pthread_cond_wait(&file->non_pleine, &file->verrou);
+    }
+    bool depose = !file->fermee;
+    if (depose) {
+        travail->suivant = NULL;
+        if (file->queue) file->queue->suivant = travail;
+        else file->tete = travail;
+        file->queue = travail;
+        file->nb++;
+        file->nb_recus++;
+        pthread_cond_signal(&file->non_vide);
+    }
+    pthread_mutex_unlock(&file->verrou);
+    return depose;
+}
+
+// NULL quand la file est fermée et vide
+static TravailServeur* prendre_travail(FileTravaux* file) {
+    pthread_mutex_lock(&file->verrou);
+    while (!file->tete && !file->fermee) {
+        pthread_cond_wait(&file->non_vide, &file->verrou);
+    }
+    TravailServeur* travail = file->tete;
+    if (travail) {
+        file->tete = travail->suivant;
+        if (!file->tete) file->queue = NULL;
+        file->nb--;
+        pthread_cond_signal(&file->non_pleine);
+    }
+    pthread_mutex_unlock(&file->verrou);
+    return travail;
+}
+
+static void fermer_file(FileTravaux* file) {
+    pthread_mutex_lock(&file->verrou);
+    file->fermee = true;
+    pthread_cond_broadcast(&file->non_vide);
+    pthread_cond_broadcast(&file->non_pleine);
+    pthread_mutex_unlock(&file->verrou);
+}
+
+/* ---- Analyse d'un travail ---- */
+
+// "coords": [[x, y], ...]
+static const char* lire_coordonnees(const char* p, const char* fin, Demande* demande) {
+    if (p >= fin || *p != '[') return NULL;
+    p = json_espaces(p + 1, fin);
+    int capacite = 0;
+    while (p < fin && *p != ']') {
+        double x, y;
+        if (*p != '[') return NULL;
+        p = json_lire_nombre(json_espaces(p + 1, fin), fin, &x);
+        if (!p) return NULL;
+        p = json_espaces(p, fin);
+        if (p >= fin || *p != ',') return NULL;
+        p = json_lire_nombre(json_espaces(p + 1, fin), fin, &y);
+        if (!p) return NULL;
+        p = json_espaces(p, fin);
+        if (p >= fin || *p != ']') return NULL;
+        p = json_espaces(p + 1, fin);
+
+        if (demande->nb_villes == capacite) {
+            capacite = capacite ? 2 * capacite : 64;
+            Ville* villes = (Ville*)realloc(demande->villes, capacite * sizeof(Ville));
+            if (!villes) return NULL;
+            demande->villes = villes;
+        }
+        Ville* ville = &demande->villes[demande->nb_villes];
+        ville->numero = ++demande->nb_villes;
+        ville->x = x;
+        ville->y = y;
+
+        if (p < fin && *p == ',') p = json_espaces(p + 1, fin);
+        else if (p >= fin || *p != ']') return NULL;
+    }
+    return p < fin ? p + 1 : NULL;
+}
+
+// Valeur de la clé 'cle' ; NULL si elle est invalide (message dans 'erreur')
+static const char* lire_champ(const char* cle, const char* p, const char* fin, Demande* demande,
+                              const char** erreur) {
+    ParamsMethode* params = &demande->params;
+    double nombre;
+    const char* suite;
+
+    if (strcmp(cle, "id") == 0) {
+        suite = json_sauter_valeur(p, fin);
+        if (suite && (size_t)(suite - p) >= sizeof(demande->id)) {
+            *erreur = "id trop long";
+            return NULL;
+        }
+        if (suite) {
+            memcpy(demande->id, p, (size_t)(suite - p));
+            demande->id[suite - p] = '\0';
+        }
+        return suite;
+    }
+    if (strcmp(cle, "instance") == 0) return json_lire_chaine(p, fin, demande->instance, sizeof(demande->instance));
+    if (strcmp(cle, "methode") == 0) return json_lire_chaine(p, fin, demande->methode, sizeof(demande->methode));
+    if (strcmp(cle, "nom") == 0) return json_lire_chaine(p, fin, demande->nom, sizeof(demande->nom));
+    if (strcmp(cle, "type") == 0) return json_lire_chaine(p, fin, demande->type, sizeof(demande->type));
+    if (strcmp(cle, "coords") == 0) return lire_coordonnees(p, fin, demande);
+    if (strcmp(cle, "grille") == 0) return json_lire_booleen(p, fin, &params->avec_grille);
+    if (strcmp(cle, "tournee") == 0) return json_lire_booleen(p, fin, &demande->avec_tournee);
+
+    suite = json_lire_nombre(p, fin, &nombre);
+    if (!suite) return json_sauter_valeur(p, fin);     // Clé inconnue : valeur ignorée
+    if (strcmp(cle, "duree") == 0) params->duree = nombre;
+    else if (strcmp(cle, "graine") == 0) params->graine = (uint64_t)nombre;
+    else if (strcmp(cle, "runs") == 0) params->nb_runs = (int)nombre;
+    else if (strcmp(cle, "threads") == 0) params->nb_threads = (int)nombre;
+    else if (strcmp(cle, "perturbations") == 0) params->nb_perturbations = (long long)nombre;
+    else if (strcmp(cle, "individus") == 0) params->nb_individus = (int)nombre;
+    else if (strcmp(cle, "generations") == 0) params->nb_generations = (int)nombre;
+    else if (strcmp(cle, "mutation") == 0) params->taux_mutation = nombre;
+    return suite;
+}
+
+// NULL si le travail est valide, message d'erreur sinon
+static const char* analyser_demande(const char* ligne, size_t longueur, Demande* demande) {
+    const char* fin = ligne + longueur;
+    const char* p = json_espaces(ligne, fin);
+    const char* erreur = NULL;
+    if (p >= fin || *p != '{') return "objet JSON attendu";
+    p = json_espaces(p + 1, fin);
+    while (p < fin && *p != '}') {
+        char cle[32];
+        p = json_lire_chaine(p, fin, cle, sizeof(cle));
+        if (!p) return "JSON invalide";
+        p = json_espaces(p, fin);
+        if (p >= fin || *p != ':') return "JSON invalide";
+        p = lire_champ(cle, json_espaces(p + 1, fin), fin, demande, &erreur);
+        if (!p) return erreur ? erreur : "JSON invalide";
+        p = json_espaces(p, fin);
+        if (p < fin && *p == ',') p = json_espaces(p + 1, fin);
+        else if (p >= fin || *p != '}') return "JSON invalide";
+    }
+    if (p >= fin) return "JSON invalide";
+    if (json_espaces(p + 1, fin) != fin) return "texte après l'objet JSON";
+
+    if (!demande->methode[0]) return "champ 'methode' manquant";
+    if (!methode_existe(demande->methode)) return "méthode non reconnue";
+    if (!demande->instance[0] && demande->nb_villes == 0) return "champ 'instance' ou 'coords' manquant";
+    if (demande->instance[0] && demande->nb_villes > 0) return "'instance' et 'coords' sont exclusifs";
+    return NULL;
+}
+
+// Instance des coordonnées du travail ; la demande cède ses villes
+static InstanceTSP* creer_instance_demande(Demande* demande, const char** erreur) {
+    TypeDistance type = DIST_EUCL_2D;
+    // EUC_2D : nom TSPLIB, accepté comme par le lecteur de fichiers
+    if (demande->type[0] == '\0' || strcmp(demande->type, "EUCL_2D") == 0
+        || strcmp(demande->type, "EUC_2D") == 0) type = DIST_EUCL_2D;
+    else if (strcmp(demande->type, "GEO") == 0) type = DIST_GEO;
+    else if (strcmp(demande->type, "ATT") == 0) type = DIST_ATT;
+    else {
+        *erreur = "type de distance non reconnu (EUCL_2D, GEO ou ATT)";
+        return NULL;
+    }
+    InstanceTSP* instance = (InstanceTSP*)calloc(1, sizeof(InstanceTSP));
+    if (!instance) return NULL;
+    snprintf(instance->nom, NOM_MAX, "%s", demande->nom[0] ? demande->nom : "coords");
+    instance->dimension = demande->nb_villes;
+    instance->type_distance = type;
+    instance->villes = demande->villes;
+    demande->villes = NULL;
+    return instance;
+}
+
+/* ---- Résolution ---- */
+
+static void ecrire_debut_reponse(FILE* sortie, const Demande* demande) {
+    fprintf(sortie, "{\"id\":%s", demande->id[0] ? demande->id : "null");
+}
+
+static void ecrire_erreur(FILE* sortie, const Demande* demande, const char* message) {
+    ecrire_debut_reponse(sortie, demande);
+    fputs(",\"statut\":\"erreur\",\"message\":", sortie);
+    json_ecrire_chaine(sortie, message);
+    fputs("}\n", sortie);
+}
+
+static void traiter_travail(Serveur* serveur, const TravailServeur* travail, FILE* sortie) {
+    Demande demande;
+    memset(&demande, 0, sizeof(Demande));
+    demande.params = serveur->params->methode;
+    demande.avec_tournee = true;
+
+    const char* erreur = analyser_demande(travail->ligne, travail->longueur, &demande);
+    EntreeCache* entree = NULL;
+    InstanceTSP* instance_demande = NULL;
+    const InstanceTSP* instance = NULL;
+    FonctionDistance dist_func = NULL;
+    const char* origine = "coords";
+
+    if (!erreur && demande.nb_villes > 0) {
+        instance_demande = creer_instance_demande(&demande, &erreur);
+        if (instance_demande && !preparer_instance(instance_demande, serveur->params->avec_alpha,
+                                                   serveur->params->renumeroter_hilbert, false, &dist_func)) {
+            erreur = "instance invalide";
+        }
+        instance = instance_demande;
+    } else if (!erreur) {
+        bool trouvee = false;
+        entree = cache_prendre(serveur->cache, demande.instance, &trouvee);
+        if (entree) {
+            instance = entree_cache_instance(entree);
+            dist_func = entree_cache_distance(entree);
+            origine = trouvee ? "cache" : "lecture";
+        } else {
+            erreur = "instance illisible";
+        }
+    }
+
+    Tournee* tournee = NULL;
+    double temps = 0.0;
+    if (!erreur && instance) {
+        tournee = resoudre_methode(instance, dist_func, demande.methode, &demande.params, &temps);
+        if (!tournee) erreur = "échec de la méthode";
+    } else if (!erreur) {
+        erreur = "mémoire insuffisante";
+    }
+
+    if (erreur) {
+        ecrire_erreur(sortie, &demande, erreur);
+    } else {
+        ecrire_debut_reponse(sortie, &demande);
+        fputs(",\"statut\":\"ok\",\"instance\":", sortie);
+        json_ecrire_chaine(sortie, instance->nom);
+        fprintf(sortie, ",\"dimension\":%d,\"methode\":\"%s\",\"longueur\":%.6f,\"temps\":%.6f,"
+                "\"origine\":\"%s\"", instance->dimension, demande.methode, tournee->distanceTotale,
+                temps, origine);
+        if (demande.avec_tournee) {
+            fputs(",\"tournee\":[", sortie);
+            // Liste des villes formatée dans un tampon puis écrite d'un bloc
+            char* tampon = (char*)malloc(TAILLE_NUMEROS_TOURNEE(tournee->taille));
+            if (tampon) {
+                fwrite(tampon, 1, formater_numeros_tournee(tampon, instance, tournee, ','), sortie);
+                free(tampon);
+            } else {
+                for (int i = 0; i < tournee->taille; i++) {
+                    fprintf(sortie, i ? ",%d" : "%d", instance->villes[tournee->chemin[i] - 1].numero);
+                }
+            }
+            fputc(']', sortie);
+        }
+        fputs("}\n", sortie);
+    }
+
+    liberer_tournee(tournee);
+    cache_rendre(serveur->cache, entree);
+    liberer_instance(instance_demande);
+    free(demande.villes);
+}
+
+static void* thread_serveur(void* arg) {
+    Serveur* serveur = (Serveur*)arg;
+    TravailServeur* travail;
+    while ((travail = prendre_travail(&serveur->file)) != NULL) {
+        char* texte = NULL;
+        size_t taille = 0;
+        FILE* reponse = open_memstream(&texte, &taille);
+        if (reponse) {
+            traiter_travail(serveur, travail, reponse);
+            fclose(reponse);
+            connexion_ecrire(travail->connexion, texte, taille);
+            free(texte);
+        }
+        connexion_relacher(travail->connexion);
+        free(travail->ligne);
+        free(travail);
+    }
+    return NULL;
+}
+
+/* ---- Lecture des travaux ---- */
+
+// Dépose chaque ligne non vide de 'entree' ; retourne à la fin du flux ou à la fermeture de la file
+static void lire_travaux(Serveur* serveur, FILE* entree, Connexion* connexion) {
+    char* ligne = NULL;
+    size_t capacite = 0;
+    ssize_t longueur;
+    while ((longueur = getline(&ligne, &capacite, entree)) >= 0) {
+        const char* debut = json_espaces(ligne, ligne + longueur);
+        if (debut == ligne + longueur) continue;
+
+        TravailServeur* travail = (TravailServeur*)malloc(sizeof(TravailServeur));
+        char* copie = (char*)malloc((size_t)longueur + 1);
+        if (!travail || !copie) {
+            free(travail);
+            free(copie);
+            break;
+        }
+        memcpy(copie, ligne, (size_t)longueur + 1);
+        travail->ligne = copie;
+        travail->longueur = (size_t)longueur;
+        travail->connexion = connexion;
+        connexion_prendre(connexion);
+        if (!deposer_travail(&serveur->file, travail)) {
+            connexion_relacher(connexion);
+            free(copie);
+            free(travail);
+            break;
+        }
+    }
+    free(ligne);
+}
+
+struct LecteurConnexion {
+    Serveur* serveur;
+    Connexion* connexion;
+    LecteurConnexion* precedent;
+    LecteurConnexion* suivant;
+};
+
+static void ajouter_lecteur(Serveur* serveur, LecteurConnexion* lecteur) {
+    pthread_mutex_lock(&serveur->verrou_lecteurs);
+    lecteur->precedent = NULL;
+    lecteur->suivant = serveur->lecteurs;
+    if (serveur->lecteurs) serveur->lecteurs->precedent = lecteur;
+    serveur->lecteurs = lecteur;
+    pthread_mutex_unlock(&serveur->verrou_lecteurs);
+}
+
+static void retirer_lecteur(Serveur* serveur, LecteurConnexion* lecteur) {
+    pthread_mutex_lock(&serveur->verrou_lecteurs);
+    if (lecteur->precedent) lecteur->precedent->suivant = lecteur->suivant;
+    else serveur->lecteurs = lecteur->suivant;
+    if (lecteur->suivant) lecteur->suivant->precedent = lecteur->precedent;
+    pthread_cond_signal(&serveur->fin_lecteur);
+    pthread_mutex_unlock(&serveur->verrou_lecteurs);
+}
+
+// Interrompt la lecture des connexions encore ouvertes et attend la fin de leurs lecteurs
+static void attendre_lecteurs(Serveur* serveur) {
+    pthread_mutex_lock(&serveur->verrou_lecteurs);
+    // Chaque lecteur garde une référence sur sa connexion : le descripteur est encore ouvert
+    for (LecteurConnexion* lecteur = serveur->lecteurs; lecteur; lecteur = lecteur->suivant) {
+        shutdown(lecteur->connexion->fd, SHUT_RD);
+    }
+    while (serveur->lecteurs) {
+        pthread_cond_wait(&serveur->fin_lecteur, &serveur->verrou_lecteurs);
+    }
+    pthread_mutex_unlock(&serveur->verrou_lecteurs);
+}
+
+static void* thread_connexion(void* arg) {
+    LecteurConnexion* lecteur = (LecteurConnexion*)arg;
+    // Copie du descripteur pour la lecture : l'original reste ouvert pour les réponses
+    int fd = dup(lecteur->connexion->fd);
+    FILE* entree = fd >= 0 ? fdopen(fd, "r") : NULL;
+    if (entree) {
+        lire_travaux(lecteur->serveur, entree, lecteur->connexion);
+        fclose(entree);
+    } else if (fd >= 0) {
+        close(fd);
+    }
+    // Après le retrait, le lecteur ne touche plus au serveur
+    Connexion* connexion = lecteur->connexion;
+    retirer_lecteur(lecteur->serveur, lecteur);
+    connexion_relacher(connexion);
+    free(lecteur);
+    return NULL;
+}
+
+// Thread détaché, créé avec SIGINT/SIGTERM bloqués (reçus par le thread principal seul)
+static bool lancer_thread(pthread_t* thread, void* (*fonction)(void*), void* arg, bool detache) {
+    sigset_t signaux, precedents;
+    sigemptyset(&signaux);
+    sigaddset(&signaux, SIGINT);
+    sigaddset(&signaux, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signaux, &precedents);
+    pthread_t local;
+    bool ok = pthread_create(thread ? thread : &local, NULL, fonction, arg) == 0;
+    if (ok && detache) pthread_detach(thread ? *thread : local);
+    pthread_sigmask(SIG_SETMASK, &precedents, NULL);
+    return ok;
+}
+
+static int ouvrir_socket(const char* chemin) {
+    struct sockaddr_un adresse;
+    memset(&adresse, 0, sizeof(adresse));
+    adresse.sun_family = AF_UNIX;
+    if (strlen(chemin) >= sizeof(adresse.sun_path)) {
+        fprintf(stderr, "Erreur: chemin de socket trop long : %s\n", chemin);
+        return -1;
+    }
+    strcpy(adresse.sun_path, chemin);
+
+    // Socket laissée par un serveur précédent : remplacée ; tout autre fichier est conservé
+    struct stat etat;
+    if (stat(chemin, &etat) == 0) {
+        if (!S_ISSOCK(etat.st_mode)) {
+            fprintf(stderr, "Erreur: %s existe et n'est pas une socket.\n", chemin);
+            return -1;
+        }
+        unlink(chemin);
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || bind(fd, (struct sockaddr*)&adresse, sizeof(adresse)) != 0 || listen(fd, SOMAXCONN) != 0) {
+        perror("Erreur socket du serveur");
+        if (fd >= 0) close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Accepte les connexions jusqu'à SIGINT/SIGTERM
+static void servir_socket(Serveur* serveur, int fd_ecoute) {
+    while (!arret_serveur) {
+        int fd = accept(fd_ecoute, NULL, NULL);
+        if (fd < 0) {
+            if (errno != EINTR) perror("Erreur accept");
+            continue;
+        }
+        LecteurConnexion* lecteur = (LecteurConnexion*)malloc(sizeof(LecteurConnexion));
+        Connexion* connexion = creer_connexion(fd, true);
+        if (!lecteur || !connexion) {
+            free(lecteur);
+            free(connexion);
+            close(fd);
+            continue;
+        }
+        lecteur->serveur = serveur;
+        lecteur->connexion = connexion;
+        ajouter_lecteur(serveur, lecteur);
+        if (!lancer_thread(NULL, thread_connexion, lecteur, true)) {
+            retirer_lecteur(serveur, lecteur);
+            connexion_relacher(connexion);
+            free(lecteur);
+        }
+    }
+}
+
+int executer_serveur(const ParamsServeur* params) {
+    Serveur serveur;
+    serveur.params = params;
+    serveur.cache = creer_cache_instances(params->memoire_cache, params->avec_alpha,
+                                          params->renumeroter_hilbert);
+    if (!serveur.cache) return -1;
+    initialiser_file(&serveur.file);
+    serveur.lecteurs = NULL;
+    pthread_mutex_init(&serveur.verrou_lecteurs, NULL);
+    pthread_cond_init(&serveur.fin_lecteur, NULL);
+
+    int fd_ecoute = -1;
+    if (params->socket) {
+        fd_ecoute = ouvrir_socket(params->socket);
+        if (fd_ecoute < 0) {
+            detruire_file(&serveur.file);
+            pthread_cond_destroy(&serveur.fin_lecteur);
+            pthread_mutex_destroy(&serveur.verrou_lecteurs);
+            liberer_cache_instances(serveur.cache);
+            return -1;
+        }
+    }
+
+    // Un client qui se déconnecte ne doit pas arrêter le serveur
+    signal(SIGPIPE, SIG_IGN);
+    struct sigaction action;
+    action.sa_handler = interruption_serveur;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = 0;            // Sans SA_RESTART : accept est interrompu
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    int nb_workers = nb_threads_effectif(params->nb_workers);
+    pthread_t* threads = (pthread_t*)malloc(nb_workers * sizeof(pthread_t));
+    int nb_lances = 0;
+    while (threads && nb_lances < nb_workers && lancer_thread(&threads[nb_lances], thread_serveur, &serveur, false)) {
+        nb_lances++;
+    }
+    if (nb_lances == 0) {
+        fprintf(stderr, "Erreur: impossible de lancer les threads du serveur.\n");
+        free(threads);
+        if (fd_ecoute >= 0) {
+            close(fd_ecoute);
+            unlink(params->socket);
+        }
+        detruire_file(&serveur.file);
+        pthread_cond_destroy(&serveur.fin_lecteur);
+        pthread_mutex_destroy(&serveur.verrou_lecteurs);
+        liberer_cache_instances(serveur.cache);
+        return -1;
+    }
+    fprintf(stderr, "Serveur : %d threads, cache %zu Mo, %s\n", nb_lances,
+            params->memoire_cache / (1024 * 1024), params->socket ? params->socket : "entrée standard");
+
+    if (params->socket) {
+        servir_socket(&serveur, fd_ecoute);
+        close(fd_ecoute);
+        unlink(params->socket);
+    } else {
+        Connexion* sortie = creer_connexion(STDOUT_FILENO, false);
+        if (sortie) {
+            lire_travaux(&serveur, stdin, sortie);
+            connexion_relacher(sortie);
+        }
+    }
+
+    // Les travaux déjà lus reçoivent leur réponse ; les lecteurs s'arrêtent
+    // avant la destruction de la file, où ils déposent
+    fermer_file(&serveur.file);
+    attendre_lecteurs(&serveur);
+    for (int t = 0; t < nb_lances; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    free(threads);
+
+    StatistiquesCache statistiques;
+    cache_statistiques(serveur.cache, &statistiques);
+    fprintf(stderr, "Serveur : %lld travaux ; cache : %lld succès, %lld lectures, %lld évictions, "
+            "%d instances (%.1f Mo)\n", serveur.file.nb_recus, statistiques.succes,
+            statistiques.chargements, statistiques.evictions, statistiques.nb_instances,
+            statistiques.memoire / (1024.0 * 1024.0));
+
+    detruire_file(&serveur.file);
+    pthread_cond_destroy(&serveur.fin_lecteur);
+    pthread_mutex_destroy(&serveur.verrou_lecteurs);
+    liberer_cache_instances(serveur.cache);
+    return 0;
+}
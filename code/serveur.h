@@ -0,0 +1,28 @@
+#ifndef SERVEUR_H
+#define SERVEUR_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "methodes.h"
+
+#define SERVEUR_MEMOIRE_CACHE_DEFAUT 1024      // Mo
+
+typedef struct {
+    ParamsMethode methode;          // Valeurs par défaut des travaux (-g -r -j -k -t)
+    bool avec_alpha;                // -a : candidats et borne calculés au chargement
+    bool renumeroter_hilbert;       // -H
+    int nb_workers;                 // Travaux résolus en même temps (0 = tous les cœurs)
+    size_t memoire_cache;           // Plafond du cache des instances (octets)
+    const char* socket;             // Socket Unix à écouter ; NULL : entrée/sortie standard
+} ParamsServeur;
+
+/**
+ * Mode serveur : lit des travaux JSON, un par ligne, sur l'entrée standard (jusqu'à
+ * la fin du flux) ou sur chaque connexion à la socket Unix (jusqu'à SIGINT/SIGTERM),
+ * les résout sur un groupe de threads et écrit une réponse JSON par travail sur
+ * la même connexion. Les instances lues restent en cache (cache_instances.h).
+ * Retourne 0, ou -1 si le serveur n'a pas pu démarrer.
+ */
+int executer_serveur(const ParamsServeur* params);
+
+#endif
@@ -0,0 +1,85 @@
+/**
+ * tas.c
+ * Tas binaire minimal avec diminution de clé (Prim, arbres couvrants)
+ */
+
+#include <stdlib.h>
+#include <float.h>
+
+#include "tas.h"
+
+TasBinaire* creer_tas(int n) {
+    TasBinaire* tas = (TasBinaire*)malloc(sizeof(TasBinaire));
+    if (!tas) return NULL;
+    tas->sommets = (int*)malloc(n * sizeof(int));
+    tas->position = (int*)malloc(n * sizeof(int));
+    tas->cle = (double*)malloc(n * sizeof(double));
+    tas->taille = 0;
+    if (!tas->sommets || !tas->position || !tas->cle) {
+        liberer_tas(tas);
+        return NULL;
+    }
+    for (int v = 0; v < n; v++) {
+        tas->position[v] = -1;
+        tas->cle[v] = DBL_MAX;
+    }
+    return tas;
+}
+
+void liberer_tas(TasBinaire* tas) {
+    if (tas) {
+        free(tas->sommets);
+        free(tas->position);
+        free(tas->cle);
+        free(tas);
+    }
+}
+
+static void tas_echanger(TasBinaire* tas, int a, int b) {
+    int sa = tas->sommets[a], sb = tas->sommets[b];
+    tas->sommets[a] = sb;
+    tas->sommets[b] = sa;
+    tas->position[sb] = a;
+    tas->position[sa] = b;
+}
+
+static void tas_remonter(TasBinaire* tas, int i) {
+    while (i > 0) {
+        int p = (i - 1) / 2;
+        if (tas->cle[tas->sommets[p]] <= tas->cle[tas->sommets[i]]) break;
+        tas_echanger(tas, i, p);
+        i = p;
+    }
+}
+
+static void tas_descendre(TasBinaire* tas, int i) {
+    while (1) {
+        int g = 2 * i + 1, d = g + 1, m = i;
+        if (g < tas->taille && tas->cle[tas->sommets[g]] < tas->cle[tas->sommets[m]]) m = g;
+        if (d < tas->taille && tas->cle[tas->sommets[d]] < tas->cle[tas->sommets[m]]) m = d;
+        if (m == i) break;
+        tas_echanger(tas, i, m);
+        i = m;
+    }
+}
+
+void tas_diminuer(TasBinaire* tas, int v, double cle) {
+    tas->cle[v] = cle;
+    if (tas->position[v] == -1) {
+        tas->sommets[tas->taille] = v;
+        tas->position[v] = tas->taille;
+        tas->taille++;
+    }
+    tas_remonter(tas, tas->position[v]);
+}
+
+int tas_extraire(TasBinaire* tas) {
+    int v = tas->sommets[0];
+    tas->taille--;
+    if (tas->taille > 0) {
+        tas_echanger(tas, 0, tas->taille);
+        tas_descendre(tas, 0);
+    }
+    tas->position[v] = -1;
+    return v;
+}
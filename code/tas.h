@@ -0,0 +1,23 @@
+#ifndef TAS_H
+#define TAS_H
+
+// Tas binaire minimal indexé par sommet (0 à n-1), avec diminution de clé
+typedef struct {
+    int* sommets;
+    int* position;      // Position de chaque sommet dans le tas, -1 si absent
+    double* cle;
+    int taille;
+} TasBinaire;
+
+// Tas vide pour n sommets (clés initialisées à DBL_MAX) ; NULL en cas d'échec
+TasBinaire* creer_tas(int n);
+
+void liberer_tas(TasBinaire* tas);
+
+// Insère v ou diminue sa clé
+void tas_diminuer(TasBinaire* tas, int v, double cle);
+
+// Retire et retourne le sommet de clé minimale
+int tas_extraire(TasBinaire* tas);
+
+#endif
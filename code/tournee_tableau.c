@@ -0,0 +1,168 @@
+/**
+ * tournee_tableau.c
+ * Tournée en tableau circulaire : mouvements 2-opt, Or-opt, échange, double-bridge,
+ * avec journal d'annulation
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tournee_tableau.h"
+
+TourneeTableau* creer_tournee_tableau(const Tournee* tournee) {
+    TourneeTableau* tableau = (TourneeTableau*)calloc(1, sizeof(TourneeTableau));
+    if (!tableau) return NULL;
+    tableau->n = tournee->taille;
+    tableau->ordre = (int*)malloc(tableau->n * sizeof(int));
+    tableau->position = (int*)malloc(tableau->n * sizeof(int));
+    if (!tableau->ordre || !tableau->position) {
+        liberer_tournee_tableau(tableau);
+        return NULL;
+    }
+    tableau_depuis_tournee(tableau, tournee);
+    return tableau;
+}
+
+void liberer_tournee_tableau(TourneeTableau* tableau) {
+    if (tableau) {
+        free(tableau->ordre);
+        free(tableau->position);
+        free(tableau->journal_positions);
+        free(tableau->journal_villes);
+        free(tableau);
+    }
+}
+
+void tableau_depuis_tournee(TourneeTableau* tableau, const Tournee* tournee) {
+    for (int i = 0; i < tableau->n; i++) {
+        tableau->ordre[i] = tournee->chemin[i] - 1;
+        tableau->position[tableau->ordre[i]] = i;
+    }
+    tableau->taille_journal = 0;
+}
+
+void tableau_vers_tournee(const TourneeTableau* tableau, Tournee* tournee) {
+    int debut = tableau->position[0];
+    for (int i = 0; i < tableau->n; i++) {
+        tournee->chemin[i] = tableau->ordre[(debut + i) % tableau->n] + 1;
+    }
+}
+
+int tableau_suivante(const TourneeTableau* tableau, int v) {
+    int p = tableau->position[v] + 1;
+    return tableau->ordre[p == tableau->n ? 0 : p];
+}
+
+int tableau_precedente(const TourneeTableau* tableau, int v) {
+    int p = tableau->position[v] - 1;
+    return tableau->ordre[p < 0 ? tableau->n - 1 : p];
+}
+
+bool tableau_dans_segment(const TourneeTableau* tableau, int v, int debut, int longueur) {
+    int p = tableau->position[v] - tableau->position[debut];
+    if (p < 0) p += tableau->n;
+    return p < longueur;
+}
+
+static void ecrire(TourneeTableau* tableau, int pos, int v) {
+    if (tableau->erreur_journal) return;
+    if (tableau->journal_actif) {
+        if (tableau->taille_journal == tableau->capacite_journal) {
+            int capacite = tableau->capacite_journal ? 2 * tableau->capacite_journal : 1024;
+            int* positions = (int*)realloc(tableau->journal_positions, capacite * sizeof(int));
+            if (positions) tableau->journal_positions = positions;
+            int* villes = (int*)realloc(tableau->journal_villes, capacite * sizeof(int));
+            if (villes) tableau->journal_villes = villes;
+            if (!positions || !villes) {
+                // Écriture refusée : le journal permet encore de tout annuler
+                tableau->erreur_journal = true;
+                return;
+            }
+            tableau->capacite_journal = capacite;
+        }
+        tableau->journal_positions[tableau->taille_journal] = pos;
+        tableau->journal_villes[tableau->taille_journal] = tableau->ordre[pos];
+        tableau->taille_journal++;
+    }
+    tableau->ordre[pos] = v;
+    tableau->position[v] = pos;
+}
+
+// Inverse le chemin de b à c (sens courant) ; le complémentaire est inversé s'il est plus court
+static void inverser_chemin(TourneeTableau* tableau, int b, int c) {
+    int n = tableau->n;
+    int i = tableau->position[b];
+    int j = tableau->position[c];
+    int longueur = (j - i + n) % n + 1;
+    if (2 * longueur > n) {
+        int k = i;
+        i = (j + 1) % n;
+        j = (k - 1 + n) % n;
+        longueur = n - longueur;
+    }
+    for (int s = 0; s < longueur / 2; s++) {
+        int vi = tableau->ordre[i], vj = tableau->ordre[j];
+        ecrire(tableau, i, vj);
+        ecrire(tableau, j, vi);
+        i = (i + 1 == n) ? 0 : i + 1;
+        j = (j == 0) ? n - 1 : j - 1;
+    }
+}
+
+void tableau_2opt(TourneeTableau* tableau, int a, int c) {
+    inverser_chemin(tableau, tableau_suivante(tableau, a), c);
+}
+
+void tableau_oropt(TourneeTableau* tableau, int s1, int s2, int u, bool inverse) {
+    int p = tableau_precedente(tableau, s1);
+    int nx = tableau_suivante(tableau, s2);
+    int v = tableau_suivante(tableau, u);
+
+    // Trois 2-opt successifs définis par les villes (le sens de parcours peut changer)
+    tableau_2opt(tableau, p, u);                            // (p,u) et (s1,v)
+    if (tableau_suivante(tableau, p) == u) tableau_2opt(tableau, p, nx);
+    else tableau_2opt(tableau, u, s2);                      // (p,nx) et (u,s2)
+    if (!inverse) {
+        if (tableau_suivante(tableau, u) == s2) tableau_2opt(tableau, u, s1);
+        else tableau_2opt(tableau, v, s2);                  // (u,s1) et (s2,v)
+    }
+}
+
+void tableau_echange(TourneeTableau* tableau, int u, int v) {
+    int pu = tableau->position[u], pv = tableau->position[v];
+    ecrire(tableau, pu, v);
+    ecrire(tableau, pv, u);
+}
+
+void tableau_echanger_segments(TourneeTableau* tableau, int i, int j, int k) {
+    int n = tableau->n;
+    int l1 = (j - i + n) % n;
+    int l2 = (k - j + n) % n;
+    int* tampon = (int*)malloc((l1 + l2) * sizeof(int));
+    if (!tampon) return;
+    for (int s = 0; s < l2; s++) tampon[s] = tableau->ordre[(j + 1 + s) % n];
+    for (int s = 0; s < l1; s++) tampon[l2 + s] = tableau->ordre[(i + 1 + s) % n];
+    for (int s = 0; s < l1 + l2; s++) ecrire(tableau, (i + 1 + s) % n, tampon[s]);
+    free(tampon);
+}
+
+void tableau_journal_debut(TourneeTableau* tableau) {
+    tableau->journal_actif = true;
+    tableau->taille_journal = 0;
+}
+
+void tableau_journal_annuler(TourneeTableau* tableau) {
+    for (int e = tableau->taille_journal - 1; e >= 0; e--) {
+        int pos = tableau->journal_positions[e];
+        int v = tableau->journal_villes[e];
+        tableau->ordre[pos] = v;
+        tableau->position[v] = pos;
+    }
+    tableau->taille_journal = 0;
+    tableau->erreur_journal = false;
+}
+
+void tableau_journal_valider(TourneeTableau* tableau) {
+    tableau->taille_journal = 0;
+}
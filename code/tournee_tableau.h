@@ -0,0 +1,64 @@
+#ifndef TOURNEE_TABLEAU_H
+#define TOURNEE_TABLEAU_H
+
+#include <stdbool.h>
+#include "tsp.h"
+
+// Tournée sous forme de tableau circulaire avec la position de chaque ville.
+// Les villes sont 0-indexées. Les mouvements sont définis par les villes et non
+// par les positions : une inversion peut porter sur le segment complémentaire,
+// ce qui retourne le sens de parcours sans changer le cycle.
+// Le journal, s'il est actif, enregistre chaque écriture pour pouvoir l'annuler.
+// S'il ne peut être agrandi, erreur_journal est levé et les écritures suivantes sont
+// refusées : le tableau reste incohérent jusqu'à tableau_journal_annuler, qui rétablit
+// l'état du début du journal.
+typedef struct {
+    int n;
+    int* ordre;             // Villes dans l'ordre de visite
+    int* position;          // Position de chaque ville dans 'ordre'
+    bool journal_actif;
+    int* journal_positions;
+    int* journal_villes;    // Ville présente avant l'écriture
+    int taille_journal;
+    int capacite_journal;
+    bool erreur_journal;    // Allocation du journal échouée depuis tableau_journal_debut
+} TourneeTableau;
+
+// Crée le tableau à partir d'une tournée (villes 1-indexées)
+TourneeTableau* creer_tournee_tableau(const Tournee* tournee);
+
+void liberer_tournee_tableau(TourneeTableau* tableau);
+
+// Recopie le tableau dans 'tournee' en commençant par la ville 1 (longueur non recalculée)
+void tableau_vers_tournee(const TourneeTableau* tableau, Tournee* tournee);
+
+// Recharge le tableau depuis une tournée de même taille
+void tableau_depuis_tournee(TourneeTableau* tableau, const Tournee* tournee);
+
+int tableau_suivante(const TourneeTableau* tableau, int v);
+int tableau_precedente(const TourneeTableau* tableau, int v);
+
+// Vrai si v est dans le segment de 'longueur' villes commençant en 'debut'
+bool tableau_dans_segment(const TourneeTableau* tableau, int v, int debut, int longueur);
+
+// 2-opt : retire (a, suiv(a)) et (c, suiv(c)), ajoute (a, c) et (suiv(a), suiv(c))
+void tableau_2opt(TourneeTableau* tableau, int a, int c);
+
+// Or-opt : déplace le segment s1..s2 (sens courant) entre u et suiv(u),
+// à l'envers si 'inverse' (u, s2 ... s1, suiv(u))
+void tableau_oropt(TourneeTableau* tableau, int s1, int s2, int u, bool inverse);
+
+// Échange les positions des villes u et v
+void tableau_echange(TourneeTableau* tableau, int u, int v);
+
+// Échange les segments ]i, j] et ]j, k] (positions circulaires, i < j < k à rotation près) :
+// double-bridge dont les trois coupures sont proches
+void tableau_echanger_segments(TourneeTableau* tableau, int i, int j, int k);
+
+// Journal : début d'enregistrement, annulation de toutes les écritures depuis le début,
+// ou validation (les écritures sont conservées)
+void tableau_journal_debut(TourneeTableau* tableau);
+void tableau_journal_annuler(TourneeTableau* tableau);
+void tableau_journal_valider(TourneeTableau* tableau);
+
+#endif
@@ -1,9 +1,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <unistd.h> // Pour getopt
+#include <unistd.h>
+#include <getopt.h> // Pour getopt_long
 #include <signal.h>
 #include <time.h>
+#include <limits.h>
 
 #include "tsp.h"
 #include "parser.h"
@@ -11,18 +13,91 @@
 #include "matrice.h"
 #include "tsp_utils.h"
 #include "force_brute.h"
-#include "heuristiques.h"
-#include "ga_generique.h"
+#include "hilbert.h"
+#include "multi_depart.h"
+#include "chrono.h"
+#include "ils.h"
+#include "alpha.h"
+#include "portfolio.h"
+#include "checkpoint.h"
+#include "instance_binaire.h"
+#include "lot.h"
+#include "serveur.h"
+#include "methodes.h"
+#include "dynamique.h"
+#include "fichier_tournee.h"
+#include "mesures.h"
 
 int nb_individus = 30;
 int nb_generations = 1000;
 double taux_mutation = 0.1;
+bool utiliser_grille = false;
+bool renumeroter_hilbert = false;
+int nb_runs = 1;
+int nb_threads = 1;
+long long nb_perturbations = 0;
+bool utiliser_alpha = false;
+double duree_limite = 0.0;
+ParamsCheckpoint params_checkpoint = { NULL, CHECKPOINT_INTERVALLE_DEFAUT, NULL };
+Tournee* tournee_initiale = NULL;   // -i : départ des méthodes d'amélioration
+
+/*  Dernière tournée affichée (celle de la méthode s'il y en a une) : écrite une
+    seule fois dans les fichiers -o et --tour-bin, à la fin de main */
+Tournee* tournee_finale = NULL;
+const char* methode_finale = NULL;
+
+static void garder_tournee_finale(Tournee* tournee, const char* methode) {
+    liberer_tournee(tournee_finale);
+    tournee_finale = tournee;
+    methode_finale = methode;
+}
+
+// Options longues (sans équivalent court)
+enum {
+    OPTION_CHECKPOINT = 256,
+    OPTION_CHECKPOINT_INTERVALLE,
+    OPTION_REPRISE,
+    OPTION_TOURNEE_OPTIMALE,
+    OPTION_SAUVEGARDE_BINAIRE,
+    OPTION_LOT,
+    OPTION_LOT_PARALLELE,
+    OPTION_FORMAT,
+    OPTION_SERVEUR,
+    OPTION_SOCKET,
+    OPTION_WORKERS,
+    OPTION_MEMOIRE_CACHE,
+    OPTION_TOURNEE_BINAIRE,
+    OPTION_DELTA,
+    OPTION_DELTA_SORTIE,
+    OPTION_MESURES,
+    OPTION_MESURES_JSON
+};
+
+static const struct option options_longues[] = {
+    { "checkpoint",          required_argument, NULL, OPTION_CHECKPOINT },
+    { "checkpoint-interval", required_argument, NULL, OPTION_CHECKPOINT_INTERVALLE },
+    { "resume",              required_argument, NULL, OPTION_REPRISE },
+    { "opt-tour",            required_argument, NULL, OPTION_TOURNEE_OPTIMALE },
+    { "save-bin",            required_argument, NULL, OPTION_SAUVEGARDE_BINAIRE },
+    { "batch",               required_argument, NULL, OPTION_LOT },
+    { "batch-jobs",          required_argument, NULL, OPTION_LOT_PARALLELE },
+    { "format",              required_argument, NULL, OPTION_FORMAT },
+    { "serve",               no_argument,       NULL, OPTION_SERVEUR },
+    { "socket",              required_argument, NULL, OPTION_SOCKET },
+    { "workers",             required_argument, NULL, OPTION_WORKERS },
+    { "cache-mem",           required_argument, NULL, OPTION_MEMOIRE_CACHE },
+    { "tour-bin",            required_argument, NULL, OPTION_TOURNEE_BINAIRE },
+    { "delta",               required_argument, NULL, OPTION_DELTA },
+    { "delta-out",           required_argument, NULL, OPTION_DELTA_SORTIE },
+    { "stats",               no_argument,       NULL, OPTION_MESURES },
+    { "stats-json",          required_argument, NULL, OPTION_MESURES_JSON },
+    { NULL, 0, NULL, 0 }
+};
 /*  Exécute la logique de test de la Partie 1 (force brute).
     Teste avec et sans matrice pré-calculée. */
 
 void test_sans_avec_matrice(InstanceTSP* instance, FonctionDistance dist_func) {
-    clock_t debut, fin;
-    double temps_cpu, temps_matrice;
+    double temps_sans, temps_matrice;
     Tournee* meilleure, * pire;
     struct sigaction action;
     action.sa_handler = gestionnaire_interruption;
@@ -47,54 +122,53 @@ void test_sans_avec_matrice(InstanceTSP* instance, FonctionDistance dist_func) {
     printf("\n========== 1. TEST SANS MATRICE PRÉCALCULÉE ==========\n");
     instance->matrice_existe = false;
 
-    debut = clock();
+    phase_debut(PHASE_CONSTRUCTION);
     int res_sans = resoudre_force_brute(instance, dist_func, &meilleure, &pire);
-    fin = clock();
-    temps_cpu = ((double)(fin - debut)) / CLOCKS_PER_SEC;
+    temps_sans = phase_fin(PHASE_CONSTRUCTION);
 
     if (res_sans) {
         printf("\n--- Résultats SANS matrice ---\n");
         afficher_banniere_normalisee();
-        afficher_tournee_normalisee(instance, meilleure, "bf-sans-mat", temps_cpu);
+        afficher_tournee_normalisee(instance, meilleure, "bf-sans-mat", temps_sans);
         printf("Pire tournée : %.2f\n", pire->distanceTotale);
+        garder_tournee_finale(meilleure, "bf-sans-mat");
     }
     else {
         printf("\nCalcul SANS matrice interrompu.\n");
+        liberer_tournee(meilleure);
     }
-    liberer_tournee(meilleure);
     liberer_tournee(pire);
 
     printf("\n========== 2. TEST AVEC MATRICE PRÉCALCULÉE ==========\n");
 
-    clock_t debut_matrice = clock();
+    phase_debut(PHASE_MATRICE);
     calculer_matrice_distances(instance, dist_func);
-    clock_t fin_matrice = clock();
-    temps_matrice = ((double)(fin_matrice - debut_matrice)) / CLOCKS_PER_SEC;
+    temps_matrice = phase_fin(PHASE_MATRICE);
     printf("Temps création matrice : %.4f secondes\n", temps_matrice);
 
-    debut = clock();
+    phase_debut(PHASE_CONSTRUCTION);
     int res_avec = resoudre_force_brute(instance, dist_func, &meilleure, &pire);
-    fin = clock();
-    double temps_calcul_avec = ((double)(fin - debut)) / CLOCKS_PER_SEC;
+    double temps_calcul_avec = phase_fin(PHASE_CONSTRUCTION);
 
     if (res_avec) {
         printf("\n--- Résultats AVEC matrice ---\n");
         afficher_banniere_normalisee();
         afficher_tournee_normalisee(instance, meilleure, "bf-avec-mat", temps_calcul_avec);
         printf("Pire tournée : %.2f\n", pire->distanceTotale);
+        garder_tournee_finale(meilleure, "bf-avec-mat");
     }
     else {
         printf("\nCalcul AVEC matrice interrompu.\n");
+        liberer_tournee(meilleure);
     }
-    liberer_tournee(meilleure);
     liberer_tournee(pire);
 
     if (res_sans && res_avec) {
         printf("\n========== COMPARAISON (Partie 1) ==========\n");
-        printf("Temps SANS matrice : %.4f sec\n", temps_cpu);
+        printf("Temps SANS matrice : %.4f sec\n", temps_sans);
         printf("Temps AVEC matrice : %.4f (calcul) + %.4f (création) = %.4f sec\n",
             temps_calcul_avec, temps_matrice, temps_calcul_avec + temps_matrice);
-        if (temps_cpu < (temps_calcul_avec + temps_matrice)) {
+        if (temps_sans < (temps_calcul_avec + temps_matrice)) {
             printf("Le calcul à la volée (SANS matrice) était plus rapide.\n");
         }
         else {
@@ -104,7 +178,6 @@ void test_sans_avec_matrice(InstanceTSP* instance, FonctionDistance dist_func) {
 }
 
 void executer_bf(InstanceTSP* instance, FonctionDistance dist_func) {
-    clock_t debut, fin;
     Tournee* meilleure, * pire;
     struct sigaction action;
     action.sa_handler = gestionnaire_interruption;
@@ -112,75 +185,131 @@ void executer_bf(InstanceTSP* instance, FonctionDistance dist_func) {
     action.sa_flags = 0;
     sigaction(SIGINT, &action, NULL);
 
-    debut = clock();
+    phase_debut(PHASE_MATRICE);
     calculer_matrice_distances(instance, dist_func);
-    int res_sans = resoudre_force_brute(instance, dist_func, &meilleure, &pire);
-    fin = clock();
+    double temps_calcul = phase_fin(PHASE_MATRICE);
+    phase_debut(PHASE_CONSTRUCTION);
+    int res_sans = resoudre_force_brute_reprise(instance, dist_func, &meilleure, &pire,
+                                                &params_checkpoint);
+    temps_calcul += phase_fin(PHASE_CONSTRUCTION);
 
-    double temps_calcul = ((double)(fin - debut)) / CLOCKS_PER_SEC;
     if (res_sans) {
+        if (echeance_atteinte()) {
+            printf("Échéance atteinte : meilleure des permutations évaluées\n");
+        }
         afficher_tournee_normalisee(instance,meilleure,"bf",temps_calcul);
-        liberer_tournee(meilleure);
+        garder_tournee_finale(meilleure, "bf");
         liberer_tournee(pire);
     }
 
 }
 
-void executer_nn(const InstanceTSP* instance, FonctionDistance dist_func, bool avecOpt) {
-    clock_t debut, fin;
-    debut = clock();
-    Tournee* tournee = plus_proche_voisin(instance, dist_func);
-    fin = clock();
-    double temps_calcul = ((double)(fin - debut)) / CLOCKS_PER_SEC;
-    if (tournee && !avecOpt){
-        afficher_tournee_normalisee(instance,tournee,"nn",temps_calcul);
-        liberer_tournee(tournee);
-    }    
-    else if (tournee && avecOpt){
-        debut = clock();
-        deux_opt(tournee, instance, dist_func);
-        fin = clock();
-        temps_calcul += ((double)(fin - debut)) / CLOCKS_PER_SEC;
-        afficher_tournee_normalisee(instance,tournee,"2optnn",temps_calcul);
-        liberer_tournee(tournee);
-    }
-}
+/*  Méthodes de construction et d'amélioration : résolues par resoudre_methode
+    (methodes.c), affichées ici avec les résumés du multi-départ et du portfolio.
+    Ctrl+C arrête ils et affiche la meilleure tournée trouvée. Le temps affiché
+    est le temps écoulé. */
+void executer_methode(const InstanceTSP* instance, FonctionDistance dist_func, const char* methode,
+                      ParamsMethode* params) {
+    ResumeMultiDepart resume_multi_depart;
+    ResumePortfolio resume_portfolio;
+    params->tournee_initiale = tournee_initiale;
+    params->checkpoint = &params_checkpoint;
+    params->avec_phases = true;
+    params->resume_multi_depart = &resume_multi_depart;
+    params->resume_portfolio = &resume_portfolio;
 
+    if (strcmp(methode, "ils") == 0) {
+        struct sigaction action;
+        ils_armer_interruption();
+        action.sa_handler = ils_interruption;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = 0;
+        sigaction(SIGINT, &action, NULL);
+    }
 
-void executer_rw(const InstanceTSP* instance, FonctionDistance dist_func, bool avecOpt) {
-    clock_t debut, fin;
-    debut = clock();
-    Tournee* tournee = marche_aleatoire(instance,dist_func);
-    fin = clock();
-    double temps_calcul = ((double)(fin - debut)) / CLOCKS_PER_SEC;
-    if (tournee && !avecOpt){
-        afficher_tournee_normalisee(instance,tournee,"rw",temps_calcul);
-        liberer_tournee(tournee);
-    }    
-    else if (tournee && avecOpt){
-        debut = clock();
-        deux_opt(tournee, instance, dist_func);
-        fin = clock();
-        temps_calcul += ((double)(fin - debut)) / CLOCKS_PER_SEC;
-        afficher_tournee_normalisee(instance,tournee,"2optrw",temps_calcul);
-        liberer_tournee(tournee);
+    double temps_calcul;
+    Tournee* tournee = resoudre_methode(instance, dist_func, methode, params, &temps_calcul);
+    if (!tournee) return;
+    if (params->nb_runs > 1 && (strcmp(methode, "2optnn") == 0 || strcmp(methode, "2optrw") == 0)) {
+        printf("Multi-départ : %d runs, %d threads, min %.6f, moyenne %.6f, max %.6f\n",
+               resume_multi_depart.nb_runs, resume_multi_depart.nb_threads, resume_multi_depart.minimum,
+               resume_multi_depart.moyenne, resume_multi_depart.maximum);
+    } else if (strcmp(methode, "portfolio") == 0) {
+        printf("Portfolio : %d threads, améliorations :", resume_portfolio.nb_threads);
+        for (int s = 0; s < PORTFOLIO_NB_SOLVEURS; s++) {
+            printf(" %s %d", nom_solveur_portfolio((SolveurPortfolio)s), resume_portfolio.ameliorations[s]);
+        }
+        printf(" (meilleure : %s)\n", nom_solveur_portfolio(resume_portfolio.solveur_meilleure));
     }
+    afficher_tournee_normalisee(instance, tournee, methode, temps_calcul);
+    garder_tournee_finale(tournee, methode);
 }
 
 int main(int argc, char* argv[]) {
     char* nomFichier = NULL;
     char* methode = NULL;
+    char* fichier_tournee_optimale = NULL;
+    char* fichier_tournee_initiale = NULL;
+    char* fichier_delta = NULL;
+    char* fichier_delta_sortie = NULL;
+    char* fichier_binaire = NULL;
+    char* manifeste_lot = NULL;
+    int nb_instances_paralleles = 1;
+    FormatLot format_lot = FORMAT_LOT_CSV;
+    bool mode_serveur = false;
+    char* socket_serveur = NULL;
+    int nb_workers = 1;
+    long memoire_cache = SERVEUR_MEMOIRE_CACHE_DEFAUT;
     bool mode_canonique = false;
+    char* fichier_tour_sortie = NULL;
+    char* fichier_tour_binaire = NULL;
+    bool afficher_mesures = false;
+    char* fichier_mesures = NULL;
     int opt;
 
-    while ((opt = getopt(argc, argv, "hf:m:c")) != -1) {
+    while ((opt = getopt_long(argc, argv, "hf:m:cgHr:j:k:at:o:i:", options_longues, NULL)) != -1) {
         switch (opt) {
         case 'h':
-            printf("Usage: %s -f <fichier.tsp> [-m <methode> | -c]\n", argv[0]);
+            printf("Usage: %s -f <fichier.tsp> [-m <methode> | -c] [-g] [-H] [-r runs -j threads] [-k perturbations] [-a] [-t secondes]\n", argv[0]);
             printf("Options:\n");
             printf("  -f <fichier>  : Fichier TSP à charger\n");
             printf("  -c            : Calculer la tournée canonique\n");
             printf("  -m <methode>  : Méthode de résolution (bf, nn, rw, ...)\n");
+            printf("  -g            : nn/2optnn : recherche du plus proche voisin par grille\n");
+            printf("  -H            : Renuméroter les villes selon la courbe de Hilbert au chargement\n");
+            printf("  -r <runs>     : 2optnn/2optrw : nombre de départs indépendants\n");
+            printf("  -j <threads>  : Nombre de threads (0 = tous les cœurs) ; sans -r, 2-opt parallèle\n");
+            printf("  -k <nombre>   : ils/decomp : nombre de perturbations double-bridge (défaut : n)\n");
+            printf("  -a            : Borne de Held-Karp et candidats alpha-nearness (sa, ils, aco)\n");
+            printf("  -t <secondes> : Durée maximale de résolution, meilleure tournée à l'échéance\n");
+            printf("                  (portfolio : défaut %.0f s)\n", PORTFOLIO_DUREE_DEFAUT);
+            printf("  -i <fichier>  : Partir de cette tournée (.tour, .tour.gz ou --tour-bin) :\n");
+            printf("                  2opt<construction>, sa, ils, ga, gadpx\n");
+            printf("  -o <fichier>  : Écrire aussi la tournée au format TSPLIB .tour (.gz : compressé)\n");
+            printf("  --checkpoint <fichier>        : bf/ga/gadpx : points de reprise (et à la réception de SIGTERM)\n");
+            printf("  --checkpoint-interval <s>     : intervalle entre deux points de reprise (défaut : %.0f s)\n",
+                   CHECKPOINT_INTERVALLE_DEFAUT);
+            printf("  --resume <fichier>            : bf/ga/gadpx : reprendre le calcul d'un point de reprise\n");
+            printf("  --opt-tour <fichier>          : Afficher la tournée d'un fichier .opt.tour (ou .opt.tour.gz,\n");
+            printf("                                  ou tournée binaire de --tour-bin)\n");
+            printf("  --tour-bin <fichier>          : Écrire aussi la tournée en binaire (en-tête et numéros int32)\n");
+            printf("  --delta <fichier>             : Appliquer des ajouts/retraits/déplacements de villes et réparer\n");
+            printf("                                  la tournée -i (puis -m l'améliore s'il est donné)\n");
+            printf("  --delta-out <fichier.tsp>     : Écrire l'instance modifiée par --delta (villes renumérotées)\n");
+            printf("  --stats                       : Temps des phases (écoulé et CPU), compteurs et mémoire maximale\n");
+            printf("                                  sur la sortie d'erreur à la fin du programme\n");
+            printf("  --stats-json <fichier>        : Mêmes mesures en JSON (- : sortie standard)\n");
+            printf("  --save-bin <fichier>          : Écrire l'instance binaire (villes, matrice, candidats -a),\n");
+            printf("                                  rechargée par -f sans analyse ni calcul\n");
+            printf("  --batch <manifeste>           : Mode lot : lignes \"fichier [methode ...]\", méthodes par défaut\n");
+            printf("                                  données par -m (séparées par des virgules)\n");
+            printf("  --batch-jobs <n>              : Instances du lot traitées en parallèle (défaut : 1, 0 = tous les cœurs)\n");
+            printf("  --format <csv|json>           : Format des résultats du lot (défaut : csv)\n");
+            printf("  --serve                       : Mode serveur : travaux JSON par ligne sur l'entrée standard\n");
+            printf("  --socket <chemin>             : Mode serveur sur une socket Unix (jusqu'à SIGINT/SIGTERM)\n");
+            printf("  --workers <n>                 : Mode serveur : travaux résolus en parallèle (défaut : 1, 0 = tous les cœurs)\n");
+            printf("  --cache-mem <Mo>              : Mode serveur : plafond du cache des instances (défaut : %d Mo)\n",
+                   SERVEUR_MEMOIRE_CACHE_DEFAUT);
             return 0;
         case 'f':
             nomFichier = optarg;
@@ -191,12 +320,137 @@ int main(int argc, char* argv[]) {
         case 'm':
             methode = optarg;
             break;
+        case 'g':
+            utiliser_grille = true;
+            break;
+        case 'H':
+            renumeroter_hilbert = true;
+            break;
+        case 'r':
+            nb_runs = atoi(optarg);
+            break;
+        case 'j':
+            nb_threads = atoi(optarg);
+            break;
+        case 'k':
+            nb_perturbations = atoll(optarg);
+            break;
+        case 'a':
+            utiliser_alpha = true;
+            break;
+        case 't':
+            duree_limite = atof(optarg);
+            break;
+        case 'i':
+            fichier_tournee_initiale = optarg;
+            break;
+        case 'o':
+            fichier_tour_sortie = optarg;
+            break;
+        case OPTION_TOURNEE_BINAIRE:
+            fichier_tour_binaire = optarg;
+            break;
+        case OPTION_DELTA:
+            fichier_delta = optarg;
+            break;
+        case OPTION_DELTA_SORTIE:
+            fichier_delta_sortie = optarg;
+            break;
+        case OPTION_MESURES:
+            afficher_mesures = true;
+            break;
+        case OPTION_MESURES_JSON:
+            fichier_mesures = optarg;
+            break;
+        case OPTION_CHECKPOINT:
+            params_checkpoint.fichier = optarg;
+            break;
+        case OPTION_CHECKPOINT_INTERVALLE:
+            params_checkpoint.intervalle = atof(optarg);
+            break;
+        case OPTION_REPRISE:
+            params_checkpoint.reprise = optarg;
+            break;
+        case OPTION_TOURNEE_OPTIMALE:
+            fichier_tournee_optimale = optarg;
+            break;
+        case OPTION_SAUVEGARDE_BINAIRE:
+            fichier_binaire = optarg;
+            break;
+        case OPTION_LOT:
+            manifeste_lot = optarg;
+            break;
+        case OPTION_LOT_PARALLELE:
+            nb_instances_paralleles = atoi(optarg);
+            break;
+        case OPTION_SERVEUR:
+            mode_serveur = true;
+            break;
+        case OPTION_SOCKET:
+            mode_serveur = true;
+            socket_serveur = optarg;
+            break;
+        case OPTION_WORKERS:
+            nb_workers = atoi(optarg);
+            break;
+        case OPTION_MEMOIRE_CACHE:
+            memoire_cache = atol(optarg);
+            break;
+        case OPTION_FORMAT:
+            if (strcmp(optarg, "csv") == 0) {
+                format_lot = FORMAT_LOT_CSV;
+            } else if (strcmp(optarg, "json") == 0) {
+                format_lot = FORMAT_LOT_JSON;
+            } else {
+                fprintf(stderr, "Erreur: format '%s' non reconnu (csv ou json).\n", optarg);
+                return EXIT_FAILURE;
+            }
+            break;
         default:
             fprintf(stderr, "Usage: %s -f <fichier.tsp> [-m <methode> | -c]\n", argv[0]);
             return EXIT_FAILURE;
         }
     }
 
+    // Mesures écrites à la sortie, quel que soit le mode et le chemin de retour
+    mesures_rapport_a_la_sortie(afficher_mesures, fichier_mesures);
+
+    // Options -g -r -j -k -t : méthodes de la ligne de commande, valeurs par défaut du lot et des travaux du serveur
+    ParamsMethode params_methode;
+    params_methode_defaut(&params_methode);
+    params_methode.avec_grille = utiliser_grille;
+    params_methode.nb_runs = nb_runs;
+    params_methode.nb_threads = nb_threads;
+    params_methode.nb_perturbations = nb_perturbations;
+    params_methode.duree = duree_limite;
+    params_methode.nb_individus = nb_individus;
+    params_methode.nb_generations = nb_generations;
+    params_methode.taux_mutation = taux_mutation;
+
+    // Mode serveur : travaux JSON, instances gardées en cache
+    if (mode_serveur) {
+        ParamsServeur serveur;
+        serveur.methode = params_methode;
+        serveur.avec_alpha = utiliser_alpha;
+        serveur.renumeroter_hilbert = renumeroter_hilbert;
+        serveur.nb_workers = nb_workers;
+        serveur.memoire_cache = (size_t)(memoire_cache > 0 ? memoire_cache : 0) * 1024 * 1024;
+        serveur.socket = socket_serveur;
+        return executer_serveur(&serveur) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // Mode lot : instances du manifeste, une ligne de résultat par méthode
+    if (manifeste_lot) {
+        ParamsLot lot;
+        lot.methode = params_methode;
+        lot.methodes_defaut = methode;
+        lot.avec_alpha = utiliser_alpha;
+        lot.renumeroter_hilbert = renumeroter_hilbert;
+        lot.nb_instances_paralleles = nb_instances_paralleles;
+        lot.format = format_lot;
+        return executer_lot(manifeste_lot, &lot, stdout) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
     if (!nomFichier) {
         fprintf(stderr, "Erreur: L'option -f est obligatoire.\n");
         fprintf(stderr, "Usage: %s -f <fichier.tsp> [-m <methode> | -c]\n", argv[0]);
@@ -204,18 +458,74 @@ int main(int argc, char* argv[]) {
     }
 
     // Lecture
+    phase_debut(PHASE_LECTURE);
     InstanceTSP* instance = lire_fichier_tsplib(nomFichier);
+    phase_fin(PHASE_LECTURE);
     if (!instance) {
         return EXIT_FAILURE;
     }
 
+    // Les instances EXPLICIT n'ont que des distances : pas de coordonnées pour
+    // la courbe de Hilbert, les grappes ou le test sans matrice
+    if (instance->type_distance == DIST_EXPLICIT) {
+        const char* refuse = renumeroter_hilbert ? "-H" : NULL;
+        if (methode && (strcmp(methode, "hilbert") == 0 || strcmp(methode, "2opthilbert") == 0
+                        || strcmp(methode, "decomp") == 0 || strcmp(methode, "bft") == 0)) {
+            refuse = methode;
+        }
+        if (refuse) {
+            fprintf(stderr, "Erreur: '%s' utilise les coordonnées des villes, absentes d'une instance EXPLICIT.\n",
+                    refuse);
+            liberer_instance(instance);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Villes proches voisines en mémoire (et dans les lignes de la matrice)
+    if (renumeroter_hilbert) {
+        renumeroter_villes_hilbert(instance);
+    }
+
     // Obtenir fonction distance 
     FonctionDistance dist_func = obtenir_fonction_distance(instance->type_distance);
     if (!dist_func) {
         liberer_instance(instance);
         return EXIT_FAILURE;
     }
-    calculer_matrice_distances(instance, dist_func);
+    // (déjà présente dans une instance binaire)
+    if (!instance->matrice_existe && instance->dimension <= DIMENSION_MAX_MATRICE) {
+        phase_debut(PHASE_MATRICE);
+        calculer_matrice_distances(instance, dist_func);
+        phase_fin(PHASE_MATRICE);
+    }
+
+    // Borne de Held-Karp et candidats alpha-nearness pour les recherches locales
+    // (ceux d'une instance binaire ne servent qu'avec -a)
+    if (instance->candidats && !utiliser_alpha) {
+        retirer_candidats_instance(instance);
+        instance->borne_inferieure = 0.0;
+    }
+    if (utiliser_alpha && instance->candidats) {
+        printf("Borne inférieure (Held-Karp) : %.6f (instance binaire)\n", instance->borne_inferieure);
+    } else if (utiliser_alpha) {
+        bool borne_exacte;
+        phase_debut(PHASE_CANDIDATS);
+        instance->candidats = calculer_candidats_alpha(instance, dist_func, NB_CANDIDATS_DEFAUT,
+                                                       &instance->borne_inferieure, &borne_exacte);
+        double temps_alpha = phase_fin(PHASE_CANDIDATS);
+        if (instance->candidats) {
+            printf("Borne inférieure (Held-Karp) : %.6f%s (%.3f s)\n", instance->borne_inferieure,
+                   borne_exacte ? "" : " approchée", temps_alpha);
+        }
+    }
+
+    if (fichier_binaire) {
+        if (!sauvegarder_instance_binaire(instance, fichier_binaire)) {
+            liberer_instance(instance);
+            return EXIT_FAILURE;
+        }
+        printf("Instance binaire écrite : %s\n", fichier_binaire);
+    }
 
     // Mode canonique
     if (mode_canonique) {
@@ -229,14 +539,127 @@ int main(int argc, char* argv[]) {
             tour->chemin[i] = i + 1;
         }
 
-        clock_t debut = clock();
+        phase_debut(PHASE_CONSTRUCTION);
         calculer_longueur_tournee(tour, instance, dist_func);
-        clock_t fin = clock();
-        double temps_calcul = (double)(fin - debut) / CLOCKS_PER_SEC;
+        double temps_calcul = phase_fin(PHASE_CONSTRUCTION);
         afficher_tournee_normalisee(instance,tour,"c",temps_calcul);
-        liberer_tournee(tour);
+        garder_tournee_finale(tour, "c");
+    }
+    // Tournée optimale publiée avec l'instance (référence pour les méthodes)
+    if (fichier_tournee_optimale) {
+        phase_debut(PHASE_LECTURE);
+        Tournee* tour = lire_fichier_tour(fichier_tournee_optimale, instance);
+        phase_fin(PHASE_LECTURE);
+        if (!tour) {
+            liberer_instance(instance);
+            return EXIT_FAILURE;
+        }
+        phase_debut(PHASE_CONSTRUCTION);
+        calculer_longueur_tournee(tour, instance, dist_func);
+        double temps_calcul = phase_fin(PHASE_CONSTRUCTION);
+        afficher_tournee_normalisee(instance, tour, "opt", temps_calcul);
+        garder_tournee_finale(tour, "opt");
+    }
+    // Tournée de départ (réoptimisation) : remplace la construction des méthodes d'amélioration
+    if (fichier_delta && !fichier_tournee_initiale) {
+        fprintf(stderr, "Erreur: --delta répare la tournée donnée par -i.\n");
+        liberer_instance(instance);
+        return EXIT_FAILURE;
+    }
+    if (fichier_tournee_initiale) {
+        bool amelioration = methode
+                         ? ((strncmp(methode, "2opt", 4) == 0 && methode_existe(methode))
+                            || strcmp(methode, "sa") == 0 || strcmp(methode, "ils") == 0
+                            || strcmp(methode, "ga") == 0 || strcmp(methode, "gadpx") == 0)
+                         : fichier_delta != NULL;
+        if (!amelioration || nb_runs > 1) {
+            fprintf(stderr, "Erreur: -i s'applique à --delta et à 2opt<construction> (sans -r), sa, ils, ga et gadpx.\n");
+            liberer_instance(instance);
+            return EXIT_FAILURE;
+        }
+        // La reprise restaure l'état sauvegardé : la tournée -i serait ignorée
+        if (params_checkpoint.reprise) {
+            fprintf(stderr, "Erreur: -i et --resume sont incompatibles.\n");
+            liberer_instance(instance);
+            return EXIT_FAILURE;
+        }
+        phase_debut(PHASE_LECTURE);
+        tournee_initiale = lire_fichier_tour(fichier_tournee_initiale, instance);
+        phase_fin(PHASE_LECTURE);
+        if (!tournee_initiale) {
+            liberer_instance(instance);
+            return EXIT_FAILURE;
+        }
+        calculer_longueur_tournee(tournee_initiale, instance, dist_func);
+        printf("Tournée initiale : %s (longueur %.6f)\n", fichier_tournee_initiale,
+               tournee_initiale->distanceTotale);
+    }
+    // Villes ajoutées, retirées ou déplacées : l'instance modifiée et la tournée réparée
+    // remplacent l'instance et la tournée de départ
+    if (fichier_delta) {
+        phase_debut(PHASE_LECTURE);
+        Delta* delta = lire_fichier_delta(fichier_delta);
+        phase_fin(PHASE_LECTURE);
+        Tournee* reparee = NULL;
+        ResumeDelta resume;
+        phase_debut(PHASE_AMELIORATION);
+        InstanceTSP* modifiee = delta ? appliquer_delta(instance, dist_func, tournee_initiale, delta,
+                                                        &reparee, &resume) : NULL;
+        double temps_calcul = phase_fin(PHASE_AMELIORATION);
+        liberer_delta(delta);
+        liberer_instance(instance);
+        liberer_tournee(tournee_initiale);
+        instance = modifiee;
+        tournee_initiale = reparee;
+        if (!instance) return EXIT_FAILURE;
+        printf("Delta : %d ajoutées, %d retirées, %d déplacées ; %lld distances calculées, "
+               "%d villes réexaminées, longueur après insertion %.6f\n",
+               resume.nb_ajouts, resume.nb_retraits, resume.nb_deplacements, resume.distances_calculees,
+               resume.villes_reexaminees, resume.longueur_inseree);
+        if (fichier_delta_sortie) {
+            if (!ecrire_instance_tsplib(fichier_delta_sortie, instance)) {
+                liberer_tournee(tournee_initiale);
+                liberer_instance(instance);
+                return EXIT_FAILURE;
+            }
+            printf("Instance modifiée écrite : %s\n", fichier_delta_sortie);
+        }
+        if (utiliser_alpha) {
+            bool borne_exacte;
+            phase_debut(PHASE_CANDIDATS);
+            instance->candidats = calculer_candidats_alpha(instance, dist_func, NB_CANDIDATS_DEFAUT,
+                                                           &instance->borne_inferieure, &borne_exacte);
+            phase_fin(PHASE_CANDIDATS);
+            if (instance->candidats) {
+                printf("Borne inférieure (Held-Karp) : %.6f%s (instance modifiée)\n", instance->borne_inferieure,
+                       borne_exacte ? "" : " approchée");
+            }
+        }
+        afficher_tournee_normalisee(instance, tournee_initiale, "delta", temps_calcul);
+        // tournee_initiale sert encore de départ à la méthode : copie
+        Tournee* copie = creer_tournee(tournee_initiale->taille);
+        if (copie) copier_tournee(copie, tournee_initiale);
+        garder_tournee_finale(copie, "delta");
     }
     if (methode != NULL) {
+        // Échéance commune à toutes les méthodes, consultée dans leurs boucles
+        // (sans -t : arrêt selon leurs propres critères)
+        if (duree_limite > 0.0) {
+            echeance_fixer(duree_limite);
+        }
+
+        bool avec_reprise = strcmp(methode, "bf") == 0 || strcmp(methode, "ga") == 0
+                         || strcmp(methode, "gadpx") == 0;
+        if ((params_checkpoint.fichier || params_checkpoint.reprise) && !avec_reprise) {
+            fprintf(stderr, "Erreur: --checkpoint et --resume ne s'appliquent qu'à bf, ga et gadpx.\n");
+            liberer_instance(instance);
+            return EXIT_FAILURE;
+        }
+        // SIGTERM (ordonnanceur) : écrire un point de reprise puis s'arrêter
+        if (params_checkpoint.fichier) {
+            checkpoint_installer_sigterm();
+        }
+
         // Sélectionner la méthode
         if (strcmp(methode, "bf") == 0) {
             executer_bf(instance, dist_func);
@@ -244,23 +667,8 @@ int main(int argc, char* argv[]) {
         else if (strcmp(methode, "bft") == 0) {
             test_sans_avec_matrice(instance, dist_func);
         }
-        else if (strcmp(methode, "nn") == 0) {
-            executer_nn(instance, dist_func, false);
-        }
-        else if (strcmp(methode, "2optnn") == 0) {
-            executer_nn(instance, dist_func, true);
-        }
-        else if (strcmp(methode, "rw") == 0) {
-            executer_rw(instance, dist_func, false);
-        }
-        else if (strcmp(methode, "2optrw") == 0) {
-            executer_rw(instance, dist_func, true);
-        }
-        else if (strcmp(methode, "ga") == 0) {
-            executer_ga(instance, dist_func,  nb_individus,  nb_generations, taux_mutation, croisement_ordonne);
-        } 
-        else if (strcmp(methode, "gadpx") == 0) {
-            executer_ga(instance, dist_func,  nb_individus,  nb_generations, taux_mutation, croisement_dpx);
+        else if (methode_existe(methode)) {
+            executer_methode(instance, dist_func, methode, &params_methode);
         }
         else {
             fprintf(stderr, "Erreur: Méthode '%s' non reconnue.\n", methode);
@@ -269,6 +677,21 @@ int main(int argc, char* argv[]) {
         }
     }
 
+    bool sorties_ok = true;
+    if (tournee_finale) {
+        phase_debut(PHASE_SORTIE);
+        if (fichier_tour_sortie && !ecrire_fichier_tour(fichier_tour_sortie, instance, tournee_finale,
+                                                        methode_finale)) {
+            sorties_ok = false;
+        }
+        if (fichier_tour_binaire && !ecrire_tournee_binaire(fichier_tour_binaire, instance, tournee_finale)) {
+            sorties_ok = false;
+        }
+        phase_fin(PHASE_SORTIE);
+    }
+
+    liberer_tournee(tournee_finale);
+    liberer_tournee(tournee_initiale);
     liberer_instance(instance);
-    return EXIT_SUCCESS;
+    return sorties_ok ? EXIT_SUCCESS : EXIT_FAILURE;
 }
\ No newline at end of file
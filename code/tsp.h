@@ -13,7 +13,8 @@
 typedef enum {
     DIST_EUCL_2D,    // Distance euclidienne
     DIST_GEO,        // Distance géographique
-    DIST_ATT         // Distance ATT pseudo-euclidienne
+    DIST_ATT,        // Distance ATT pseudo-euclidienne
+    DIST_EXPLICIT    // Distances données par le fichier (EDGE_WEIGHT_SECTION), sans coordonnées
 } TypeDistance;
 
 
@@ -36,6 +37,12 @@ typedef struct {
     Ville* villes;                // Tableau des villes
     double** matrice_distances;   // Matrice triangulaire inférieure
     bool matrice_existe;        // true si matrice existe/remplit, false sinon
+
+    struct ListesCandidats* candidats;  // Candidats alpha-nearness (option -a), NULL sinon
+    double borne_inferieure;            // Borne de Held-Karp, 0 si non calculée
+
+    void* projection;           // Instance binaire projetée (instance_binaire.h), NULL sinon :
+    size_t taille_projection;   // villes, matrice et candidats peuvent pointer dedans
 } InstanceTSP;
 
 // Structure pour une tournée (solution)
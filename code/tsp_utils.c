@@ -1,5 +1,7 @@
 #include "tsp_utils.h"
 #include "matrice.h" // Pour obtenir_distance_matrice
+#include "fichier_tournee.h"
+#include "mesures.h"
 
 // Gestion Tournée
 
@@ -70,18 +72,30 @@ long long factorial(int n) {
 // Affichage
 
 void afficher_banniere_normalisee(void) {
-    printf("Instance; Méthode; Temps CPU (sec); Longueur; Tour\n");
+    printf("Instance; Méthode; Temps écoulé (sec); Longueur; Tour\n");
 }
 
 void afficher_tournee_normalisee(const InstanceTSP* instance, 
                                  const Tournee* tournee, 
                                  const char* methode, 
-                                 double temps_cpu) {
-                                    
-    printf("Tour : %s %s %.6f %.6f [", instance->nom, methode, temps_cpu, tournee->distanceTotale);    
-    for (int i = 0; i < tournee->taille; i++) {
-        printf("%d", tournee->chemin[i]);
-        if (i < tournee->taille - 1) printf(",");
+                                 double temps_calcul) {
+    phase_debut(PHASE_SORTIE);
+    printf("Tour : %s %s %.6f %.6f [", instance->nom, methode, temps_calcul, tournee->distanceTotale);    
+    // Toute la liste des villes formatée dans un tampon puis écrite d'un bloc
+    char* tampon = (char*)malloc(TAILLE_NUMEROS_TOURNEE(tournee->taille));
+    if (tampon) {
+        fwrite(tampon, 1, formater_numeros_tournee(tampon, instance, tournee, ','), stdout);
+        free(tampon);
+    } else {
+        for (int i = 0; i < tournee->taille; i++) {
+            printf("%d", instance->villes[tournee->chemin[i] - 1].numero);
+            if (i < tournee->taille - 1) printf(",");
+        }
     }
     printf("]\n");
+    if (instance->borne_inferieure > 0.0) {
+        printf("Écart à la borne inférieure : %.3f %%\n",
+               100.0 * (tournee->distanceTotale - instance->borne_inferieure) / instance->borne_inferieure);
+    }
+    phase_fin(PHASE_SORTIE);
 }
\ No newline at end of file
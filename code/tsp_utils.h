@@ -18,7 +18,7 @@ long long factorial(int n);
 void afficher_tournee_normalisee(const InstanceTSP* instance, 
                                  const Tournee* tournee, 
                                  const char* methode, 
-                                 double temps_cpu);
+                                 double temps_calcul);
 
                                  
 void afficher_banniere_normalisee(void);